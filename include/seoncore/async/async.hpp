@@ -0,0 +1,4 @@
+#pragma once
+#include <seoncore/async/task.hpp>
+#include <seoncore/async/ops.hpp>
+#include <seoncore/async/graph.hpp>
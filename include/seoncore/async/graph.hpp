@@ -0,0 +1,281 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <seoncore/async/ops.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/ops/transform.hpp>
+#include <seoncore/ops/reduce.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::async
+{
+
+// DAG of matrix ops over DenseMatrix<TN> values and TN scalars. Nodes are
+// added in dependency order (a node can only use nodes created before it,
+// so the graph is acyclic by construction); run() executes every node once
+// its inputs are ready, independent nodes concurrently on the shared pool.
+//
+//   TaskGraph<double> g;
+//   auto a = g.input(A), b = g.input(B);
+//   auto p = g.matmul(a, b);
+//   auto s = g.sum(g.abs(p));          // abs and transpose(p) overlap
+//   auto t = g.transpose(p);
+//   g.run();
+//   double total = g.scalar(s);
+template <typename TN>
+class TaskGraph
+{
+public:
+    using matrix_type   = seoncore::matrix::DenseMatrix<TN>;
+    using value_type    = std::variant<matrix_type, TN>;
+
+    struct Node
+    {
+        std::size_t id;
+    };
+
+    // Inputs are stored in the graph once; dependents read them in place on
+    // every run.
+    Node input(matrix_type m)
+    {
+        return _add_input(value_type(std::move(m)));
+    };
+
+    Node input(TN scalar)
+    {
+        return _add_input(value_type(scalar));
+    };
+
+    Node matmul(Node a, Node b)
+    {
+        return _add({ a, b }, [a, b](const TaskGraph& g)
+        {
+            return value_type(seoncore::ops::matmul(g.matrix(a), g.matrix(b)));
+        });
+    };
+
+    Node abs(Node a)
+    {
+        return _add({ a }, [a](const TaskGraph& g) { return value_type(seoncore::ops::abs(g.matrix(a))); });
+    };
+
+    Node transpose(Node a)
+    {
+        return _add({ a }, [a](const TaskGraph& g) { return value_type(detail::transposed_copy(g.matrix(a))); });
+    };
+
+    Node sum(Node a)
+    {
+        return _add({ a }, [a](const TaskGraph& g) { return value_type(seoncore::ops::sum(g.matrix(a))); });
+    };
+
+    Node min(Node a)
+    {
+        return _add({ a }, [a](const TaskGraph& g) { return value_type(seoncore::ops::min(g.matrix(a))); });
+    };
+
+    Node max(Node a)
+    {
+        return _add({ a }, [a](const TaskGraph& g) { return value_type(seoncore::ops::max(g.matrix(a))); });
+    };
+
+    // Custom node: fn(graph) -> value_type, reading its inputs through
+    // graph.matrix() / graph.scalar() on the listed dependencies only.
+    template <class F>
+    Node apply(std::vector<Node> deps, F fn)
+    {
+        return _add(std::move(deps), std::function<value_type(const TaskGraph&)>(std::move(fn)));
+    };
+
+    std::size_t size() const noexcept { return _nodes.size(); };
+
+    // Results; valid after run() and until the next run().
+    const matrix_type& matrix(Node n) const { return std::get<matrix_type>(_nodes[n.id].value); };
+    TN scalar(Node n) const { return std::get<TN>(_nodes[n.id].value); };
+    const value_type& value(Node n) const { return _nodes[n.id].value; };
+
+    // Executes the whole graph and waits for it, helping with pool work
+    // while waiting. If nodes throw, their dependents are skipped and the
+    // first exception is rethrown here. May be run again.
+    void run()
+    {
+        auto& pool = seoncore::parallel::default_pool();
+        if (_nodes.empty()) return;
+
+        _start();
+
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lk(_mx);
+                if (_remaining == 0) break;
+            };
+            if (pool.run_pending()) continue;
+
+            // Short waits, so queued work is picked up even if every worker
+            // is itself waiting on a graph.
+            std::unique_lock<std::mutex> lk(_mx);
+            _done.wait_for(lk, std::chrono::milliseconds(1), [this] { return _remaining == 0; });
+        };
+
+        if (_error) std::rethrow_exception(_error);
+    };
+
+    // run() as a task, so a coroutine can co_await the whole graph. No
+    // thread waits on it: the node that finishes last resumes the task.
+    Task<void> run_async()
+    {
+        co_await _completion{ this };
+        if (_error) std::rethrow_exception(_error);
+    };
+
+private:
+    struct _node
+    {
+        std::vector<std::size_t>                        deps;
+        std::vector<std::size_t>                        next;
+        std::function<value_type(const TaskGraph&)>     fn;                 // empty for inputs
+        value_type                                      value;
+        bool                                            failed = false;
+    };
+
+    std::vector<_node>                              _nodes;
+    std::unique_ptr<std::atomic<std::size_t>[]>     _pending;
+    std::size_t                                     _remaining = 0;    // guarded by _mx
+    std::exception_ptr                              _error;             // guarded by _mx
+    std::atomic<std::uintptr_t>                     _state{ detail::_done };
+    std::mutex                                      _mx;
+    std::condition_variable                         _done;
+
+    // Starts the graph and suspends until its last node is done. _state
+    // follows detail::_promise_base: _running, _done, or the address of
+    // the one coroutine to resume on completion.
+    struct _completion
+    {
+        TaskGraph* g;
+
+        bool await_ready() const noexcept { return g->_nodes.empty(); };
+
+        bool await_suspend(std::coroutine_handle<> waiter)
+        {
+            g->_start();
+
+            std::uintptr_t expected = detail::_running;
+            return g->_state.compare_exchange_strong(
+                expected, reinterpret_cast<std::uintptr_t>(waiter.address()),
+                std::memory_order_acq_rel, std::memory_order_acquire);
+        };
+
+        constexpr void await_resume() const noexcept {};
+    };
+
+    template <class F>
+    Node _add(std::vector<Node> deps, F&& fn)
+    {
+        const std::size_t id = _nodes.size();
+
+        _node node;
+        node.fn = std::forward<F>(fn);
+        for (Node d : deps)
+        {
+            assert(d.id < id);
+            node.deps.push_back(d.id);
+            _nodes[d.id].next.push_back(id);
+        };
+        _nodes.push_back(std::move(node));
+
+        return { id };
+    };
+
+    Node _add_input(value_type v)
+    {
+        _node node;
+        node.value = std::move(v);
+        _nodes.push_back(std::move(node));
+
+        return { _nodes.size() - 1 };
+    };
+
+    // Resets the per-run state and submits the nodes without inputs.
+    void _start()
+    {
+        const std::size_t n = _nodes.size();
+
+        _pending = std::make_unique<std::atomic<std::size_t>[]>(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            _pending[i].store(_nodes[i].deps.size(), std::memory_order_relaxed);
+            _nodes[i].failed = false;
+        };
+        _remaining = n;
+        _error = nullptr;
+        _state.store(detail::_running, std::memory_order_release);
+
+        for (std::size_t i = 0; i < n; ++i)
+            if (_nodes[i].deps.empty())
+                _submit(i);
+    };
+
+    void _submit(std::size_t i)
+    {
+        seoncore::parallel::default_pool().submit([this, i] { _execute(i); });
+    };
+
+    void _execute(std::size_t i)
+    {
+        _node& node = _nodes[i];
+
+        bool skip = false;
+        for (std::size_t d : node.deps)
+            skip = skip || _nodes[d].failed;
+
+        if (skip)
+            node.failed = true;
+        else if (node.fn)
+        {
+            try { node.value = node.fn(*this); }
+            catch (...)
+            {
+                node.failed = true;
+                std::lock_guard<std::mutex> lk(_mx);
+                if (!_error) _error = std::current_exception();
+            };
+        };
+
+        for (std::size_t s : node.next)
+            if (_pending[s].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                _submit(s);
+
+        // Finish under the lock: once run() sees zero, or the awaiting
+        // coroutine is resumed, the graph may go away.
+        std::coroutine_handle<> waiter;
+        {
+            std::lock_guard<std::mutex> lk(_mx);
+            if (--_remaining != 0) return;
+
+            const std::uintptr_t prev = _state.exchange(detail::_done, std::memory_order_acq_rel);
+            if (prev != detail::_running)
+                waiter = std::coroutine_handle<>::from_address(reinterpret_cast<void*>(prev));
+            _done.notify_all();
+        };
+
+        if (waiter) waiter.resume();
+    };
+
+}; // class TaskGraph<TN>
+
+}; // namespace seoncore::async
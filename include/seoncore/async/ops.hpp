@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <seoncore/async/task.hpp>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/ops/transform.hpp>
+#include <seoncore/ops/reduce.hpp>
+
+// Asynchronous forms of the matrix ops. Each returns a Task that is
+// already running on the shared pool. Operands are taken by reference and
+// must outlive the task; awaiting the call directly, as in
+// `co_await async::matmul(A, B)`, always satisfies that.
+
+namespace seoncore::async
+{
+
+namespace detail
+{
+
+template <seoncore::concepts::MatrixLike A>
+seoncore::matrix::DenseMatrix<typename A::value_type> transposed_copy(const A& a)
+{
+    seoncore::matrix::DenseMatrix<typename A::value_type> t(a.cols(), a.rows());
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            t(j, i) = a(i, j);
+    return t;
+};
+
+}; // namespace detail
+
+template <seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike B>
+auto matmul(const A& a, const B& b)
+    -> Task<decltype(seoncore::ops::matmul(a, b))>
+{
+    co_return seoncore::ops::matmul(a, b);
+};
+
+template <seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike B, seoncore::ops::GemmEpilogueLike E>
+auto matmul(const A& a, const B& b, E epi)
+    -> Task<decltype(seoncore::ops::matmul(a, b, epi))>
+{
+    co_return seoncore::ops::matmul(a, b, epi);
+};
+
+template <seoncore::concepts::MatrixLike A>
+auto abs(const A& a)
+    -> Task<decltype(seoncore::ops::abs(a))>
+{
+    co_return seoncore::ops::abs(a);
+};
+
+template <seoncore::concepts::MatrixLike A>
+auto sum(const A& a) -> Task<typename A::value_type>
+{
+    co_return seoncore::ops::sum(a);
+};
+
+template <seoncore::concepts::MatrixLike A>
+auto min(const A& a) -> Task<typename A::value_type>
+{
+    co_return seoncore::ops::min(a);
+};
+
+template <seoncore::concepts::MatrixLike A>
+auto max(const A& a) -> Task<typename A::value_type>
+{
+    co_return seoncore::ops::max(a);
+};
+
+// Materialized transpose, as a row-major DenseMatrix.
+template <seoncore::concepts::MatrixLike A>
+auto transpose(const A& a) -> Task<seoncore::matrix::DenseMatrix<typename A::value_type>>
+{
+    co_return detail::transposed_copy(a);
+};
+
+}; // namespace seoncore::async
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::async
+{
+
+template <typename T = void>
+class Task;
+
+namespace detail
+{
+
+inline constexpr std::uintptr_t _running = 0;
+inline constexpr std::uintptr_t _done    = 1;
+
+// State shared by every promise. `state` is _running, _done, or the
+// address of the one coroutine awaiting the result. The frame is owned
+// jointly by the Task handle and the running body; whichever lets go last
+// destroys it, so a Task may be dropped before its work finishes.
+struct _promise_base
+{
+    std::atomic<std::uintptr_t> state{ _running };
+    std::atomic<int>            refs{ 2 };
+    std::exception_ptr          error;
+
+    // Tasks are eager: the body starts on the shared pool right away, so
+    // tasks created back to back run concurrently.
+    struct _start
+    {
+        constexpr bool await_ready() const noexcept { return false; };
+
+        void await_suspend(std::coroutine_handle<> h)
+        {
+            seoncore::parallel::default_pool().submit([h] { h.resume(); });
+        };
+
+        constexpr void await_resume() const noexcept {};
+    };
+
+    struct _finish
+    {
+        constexpr bool await_ready() const noexcept { return false; };
+
+        template <class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept
+        {
+            Promise& p = h.promise();
+
+            const std::uintptr_t prev = p.state.exchange(_done, std::memory_order_acq_rel);
+            p.state.notify_all();
+
+            std::coroutine_handle<> next = (prev == _running)
+                ? std::coroutine_handle<>(std::noop_coroutine())
+                : std::coroutine_handle<>::from_address(reinterpret_cast<void*>(prev));
+
+            if (p.refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                h.destroy();
+
+            return next;
+        };
+
+        constexpr void await_resume() const noexcept {};
+    };
+
+    _start initial_suspend() noexcept { return {}; };
+    _finish final_suspend() noexcept { return {}; };
+
+    void unhandled_exception() noexcept { error = std::current_exception(); };
+
+    bool ready() const noexcept { return state.load(std::memory_order_acquire) == _done; };
+
+    // Registers `waiter` to be resumed on completion; false if the task
+    // already finished and the waiter should just continue.
+    bool await(std::coroutine_handle<> waiter) noexcept
+    {
+        std::uintptr_t expected = _running;
+        return state.compare_exchange_strong(
+            expected, reinterpret_cast<std::uintptr_t>(waiter.address()),
+            std::memory_order_acq_rel, std::memory_order_acquire);
+    };
+
+    // Blocks until completion, running queued pool work meanwhile.
+    void wait() noexcept
+    {
+        auto& pool = seoncore::parallel::default_pool();
+        while (!ready())
+            if (!pool.run_pending())
+                state.wait(_running, std::memory_order_acquire);
+    };
+};
+
+template <typename T>
+struct _promise : _promise_base
+{
+    std::optional<T> value;
+
+    Task<T> get_return_object() noexcept;
+
+    template <class U>
+    void return_value(U&& v) { value.emplace(std::forward<U>(v)); };
+
+    T take()
+    {
+        if (error) std::rethrow_exception(error);
+        return std::move(*value);
+    };
+};
+
+template <>
+struct _promise<void> : _promise_base
+{
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {};
+
+    void take()
+    {
+        if (error) std::rethrow_exception(error);
+    };
+};
+
+}; // namespace detail
+
+// Result of an asynchronous computation. The body is already running on
+// the pool when the Task is returned; `co_await` it from a coroutine, or
+// call get() to block. The result can be taken once.
+template <typename T>
+class Task
+{
+public:
+    using promise_type  = detail::_promise<T>;
+    using value_type    = T;
+
+    Task() noexcept = default;
+
+    explicit Task(std::coroutine_handle<promise_type> h) noexcept
+        : _h(h)
+    {};
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    Task(Task&& other) noexcept
+        : _h(std::exchange(other._h, {}))
+    {};
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this == &other) return *this;
+
+        _release();
+        _h = std::exchange(other._h, {});
+        return *this;
+    };
+
+    ~Task() noexcept { _release(); };
+
+    bool valid() const noexcept { return static_cast<bool>(_h); };
+    bool ready() const noexcept { return _h && _h.promise().ready(); };
+
+    // Blocking wait. Do not call from inside a pool task; co_await there.
+    T get()
+    {
+        _h.promise().wait();
+        return _h.promise().take();
+    };
+
+    auto operator co_await() && noexcept { return _awaiter{ _h }; };
+    auto operator co_await() & noexcept { return _awaiter{ _h }; };
+
+private:
+    std::coroutine_handle<promise_type> _h;
+
+    struct _awaiter
+    {
+        std::coroutine_handle<promise_type> h;
+
+        bool await_ready() const noexcept { return h.promise().ready(); };
+        bool await_suspend(std::coroutine_handle<> waiter) noexcept { return h.promise().await(waiter); };
+        T await_resume() { return h.promise().take(); };
+    };
+
+    void _release() noexcept
+    {
+        if (!_h) return;
+
+        if (_h.promise().refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            _h.destroy();
+        _h = {};
+    };
+
+}; // class Task<T>
+
+template <typename T>
+Task<T> detail::_promise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<_promise<T>>::from_promise(*this));
+};
+
+inline Task<void> detail::_promise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<_promise<void>>::from_promise(*this));
+};
+
+// `co_await schedule()` moves the rest of the coroutine onto the pool.
+inline auto schedule() noexcept { return detail::_promise_base::_start{}; };
+
+template <typename T>
+T sync_wait(Task<T> task) { return task.get(); };
+
+}; // namespace seoncore::async
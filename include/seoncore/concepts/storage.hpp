@@ -0,0 +1,37 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+
+namespace seoncore::concepts
+{
+
+// Element buffer behind a DenseMatrix. `std::vector` is the reference model:
+// sized construction value-initializes, non-const access may be used to
+// write, const access must not change observable state.
+template <class S>
+concept DenseStorage =
+requires(S s, const S cs, std::size_t n)
+{
+    typename S::value_type;
+
+    S(n);
+    { s.data() } -> std::convertible_to<typename S::value_type*>;
+    { cs.data() } -> std::convertible_to<const typename S::value_type*>;
+    { cs.size() } -> std::convertible_to<std::size_t>;
+    s[n];
+    cs[n];
+};
+
+// DenseStorage whose copies share one buffer until written to, instead of
+// duplicating it; recognized by its use_count().
+template <class S>
+concept CopyOnWriteStorage =
+DenseStorage<S> &&
+requires(const S cs)
+{
+    { cs.use_count() } -> std::convertible_to<std::size_t>;
+};
+
+
+}; // namespace seoncore::concepts
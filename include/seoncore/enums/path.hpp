@@ -0,0 +1,16 @@
+#pragma once
+
+
+
+namespace seoncore::enums
+{
+
+// How an op call was dispatched.
+enum class Path
+{
+    Tagged,     // a tag_invoke overload
+    Fallback,   // the generic *_fallback implementation
+    Direct      // no dispatch: the op has a single implementation
+};
+
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+
+
+namespace seoncore::enums
+{
+
+enum class Triangle
+{
+    Upper,
+    Lower
+};
+
+};
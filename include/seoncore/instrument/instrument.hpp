@@ -0,0 +1,290 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <seoncore/enums/path.hpp>
+
+// Op-level instrumentation. Build with SEONCORE_INSTRUMENT=1 to record, per
+// call at the ops:: dispatch points, the shape, wall time, FLOPs, bytes
+// moved, dispatch path and DenseMatrix allocations. Without it the hooks
+// below expand to nothing and none of this code is reached; the query API
+// still compiles and simply reports nothing.
+
+#ifndef SEONCORE_INSTRUMENT
+#define SEONCORE_INSTRUMENT 0
+#endif
+
+namespace seoncore::instrument
+{
+
+inline constexpr bool enabled = (SEONCORE_INSTRUMENT != 0);
+
+struct OpEvent
+{
+    const char*     op;
+    enums::Path     path;
+    std::size_t     rows;
+    std::size_t     cols;
+    std::size_t     inner;      // contraction length, 0 if none
+    double          flops;
+    double          bytes;
+    std::uint64_t   allocs;     // DenseMatrix allocations inside the call
+    std::uint64_t   start_ns;   // since the registry was first touched
+    std::uint64_t   dur_ns;
+    std::uint32_t   tid;
+};
+
+struct OpStats
+{
+    std::uint64_t   calls = 0;
+    std::uint64_t   tagged = 0;
+    std::uint64_t   fallback = 0;
+    std::uint64_t   direct = 0;
+    std::uint64_t   total_ns = 0;
+    std::uint64_t   max_ns = 0;
+    double          flops = 0.0;
+    double          bytes = 0.0;
+    std::uint64_t   allocs = 0;
+};
+
+class Registry
+{
+public:
+    static Registry& instance()
+    {
+        static Registry r;
+        return r;
+    };
+
+    void record(const OpEvent& ev)
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+
+        OpStats& s = _stats[ev.op];
+        ++s.calls;
+        switch (ev.path)
+        {
+            case enums::Path::Tagged:   ++s.tagged;   break;
+            case enums::Path::Fallback: ++s.fallback; break;
+            case enums::Path::Direct:   ++s.direct;   break;
+        };
+        s.total_ns += ev.dur_ns;
+        if (ev.dur_ns > s.max_ns) s.max_ns = ev.dur_ns;
+        s.flops  += ev.flops;
+        s.bytes  += ev.bytes;
+        s.allocs += ev.allocs;
+
+        if (_events.size() < _capacity) _events.push_back(ev);
+        else                            ++_dropped;
+    };
+
+    // Aggregates keyed by op name.
+    std::map<std::string, OpStats> stats() const
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+        return _stats;
+    };
+
+    std::vector<OpEvent> events() const
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+        return _events;
+    };
+
+    std::uint64_t dropped() const
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+        return _dropped;
+    };
+
+    // Maximum number of per-call events kept for trace export; aggregates
+    // are always updated.
+    void set_event_capacity(std::size_t n)
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+        _capacity = n;
+    };
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+        _stats.clear();
+        _events.clear();
+        _dropped = 0;
+    };
+
+    // Chrome trace / Perfetto JSON ("X" complete events, microseconds).
+    void write_chrome_trace(std::ostream& os) const
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+
+        os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        for (std::size_t i = 0; i < _events.size(); ++i)
+        {
+            const OpEvent& e = _events[i];
+            if (i != 0) os << ',';
+            os << "{\"name\":\"" << e.op << "\""
+               << ",\"cat\":\"" << path_name(e.path) << "\""
+               << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.tid
+               << ",\"ts\":" << static_cast<double>(e.start_ns) / 1e3
+               << ",\"dur\":" << static_cast<double>(e.dur_ns) / 1e3
+               << ",\"args\":{\"rows\":" << e.rows
+               << ",\"cols\":" << e.cols
+               << ",\"inner\":" << e.inner
+               << ",\"flops\":" << e.flops
+               << ",\"bytes\":" << e.bytes
+               << ",\"allocs\":" << e.allocs << "}}";
+        };
+        os << "]}";
+    };
+
+    static const char* path_name(enums::Path p) noexcept
+    {
+        switch (p)
+        {
+            case enums::Path::Tagged:   return "tagged";
+            case enums::Path::Fallback: return "fallback";
+            case enums::Path::Direct:   return "direct";
+        };
+        return "?";
+    };
+
+    std::uint64_t now_ns() const noexcept
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - _epoch).count());
+    };
+
+private:
+    Registry()
+        : _epoch(std::chrono::steady_clock::now())
+    {};
+
+    mutable std::mutex                      _mx;
+    std::map<std::string, OpStats>          _stats;
+    std::vector<OpEvent>                    _events;
+    std::size_t                             _capacity = std::size_t{1} << 20;
+    std::uint64_t                           _dropped = 0;
+    std::chrono::steady_clock::time_point   _epoch;
+
+}; // class Registry
+
+struct AllocCounter
+{
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;
+};
+
+inline AllocCounter& thread_allocs() noexcept
+{
+    thread_local AllocCounter c;
+    return c;
+};
+
+inline std::atomic<std::uint64_t>& total_allocs() noexcept
+{
+    static std::atomic<std::uint64_t> n{0};
+    return n;
+};
+
+inline void count_alloc(std::size_t bytes) noexcept
+{
+    AllocCounter& c = thread_allocs();
+    ++c.count;
+    c.bytes += bytes;
+    total_allocs().fetch_add(1, std::memory_order_relaxed);
+};
+
+inline std::uint32_t thread_index() noexcept
+{
+    static std::atomic<std::uint32_t> next{0};
+    thread_local const std::uint32_t id = next.fetch_add(1, std::memory_order_relaxed);
+    return id;
+};
+
+// Times one op call and records it on destruction. Usable in constexpr
+// functions: nothing happens during constant evaluation.
+class OpScope
+{
+public:
+    constexpr OpScope(
+            const char* op,
+            enums::Path path,
+            std::size_t rows,
+            std::size_t cols,
+            std::size_t inner,
+            double flops,
+            double bytes) noexcept
+        : _ev{ op, path, rows, cols, inner, flops, bytes, 0, 0, 0, 0 }
+    {
+        if (!std::is_constant_evaluated()) _begin();
+    };
+
+    OpScope(const OpScope&) = delete;
+    OpScope& operator=(const OpScope&) = delete;
+
+    constexpr ~OpScope() noexcept
+    {
+        if (!std::is_constant_evaluated()) _end();
+    };
+
+private:
+    OpEvent         _ev;
+
+    void _begin() noexcept
+    {
+        _ev.allocs = thread_allocs().count;
+        _ev.start_ns = Registry::instance().now_ns();
+    };
+
+    void _end() noexcept
+    {
+        Registry& r = Registry::instance();
+        _ev.dur_ns = r.now_ns() - _ev.start_ns;
+        _ev.allocs = thread_allocs().count - _ev.allocs;
+        _ev.tid = thread_index();
+
+        try { r.record(_ev); }
+        catch (...) {};
+    };
+
+}; // class OpScope
+
+inline std::map<std::string, OpStats> stats() { return Registry::instance().stats(); };
+inline std::vector<OpEvent> events() { return Registry::instance().events(); };
+inline void reset() { Registry::instance().reset(); };
+inline void write_chrome_trace(std::ostream& os) { Registry::instance().write_chrome_trace(os); };
+
+}; // namespace seoncore::instrument
+
+#define SEONCORE_INSTRUMENT_CAT_(a, b) a##b
+#define SEONCORE_INSTRUMENT_CAT(a, b) SEONCORE_INSTRUMENT_CAT_(a, b)
+
+#if SEONCORE_INSTRUMENT
+
+#define SEONCORE_OP_SCOPE(op, path, rows, cols, inner, flops, bytes)              \
+    const ::seoncore::instrument::OpScope SEONCORE_INSTRUMENT_CAT(_seon_scope_, __LINE__)( \
+        op, path, rows, cols, inner,                                              \
+        static_cast<double>(flops), static_cast<double>(bytes))
+
+#define SEONCORE_COUNT_ALLOC(bytes)                                               \
+    do {                                                                          \
+        if (!std::is_constant_evaluated())                                        \
+            ::seoncore::instrument::count_alloc(bytes);                           \
+    } while (0)
+
+#else
+
+#define SEONCORE_OP_SCOPE(op, path, rows, cols, inner, flops, bytes) ((void)0)
+#define SEONCORE_COUNT_ALLOC(bytes) ((void)0)
+
+#endif
@@ -33,7 +33,7 @@ public:
 
     constexpr iter_stride& operator=(const iter_stride& other) noexcept
     {
-        if (this == other) return *this;
+        if (this == &other) return *this;
 
         _data = other._data;
         _stride = other._stride;
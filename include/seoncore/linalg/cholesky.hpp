@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/strided.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::linalg
+{
+
+// A = L * L^T with L lower triangular (its strict upper triangle is zero).
+template <typename TN>
+struct Cholesky
+{
+    seoncore::matrix::DenseMatrix<TN>   L;
+    bool                                ok = false;     // false if A is not positive definite
+};
+
+namespace detail
+{
+
+// Columns per step of the blocked factorization and of up/downdates.
+inline constexpr std::size_t cholesky_block = 64;
+
+// Element (i, j) of a strided matrix.
+template <typename TN>
+struct _strided_ref
+{
+    TN*             data;
+    std::ptrdiff_t  rs;
+    std::ptrdiff_t  cs;
+
+    TN& operator()(std::size_t i, std::size_t j) const noexcept
+    {
+        return data[static_cast<std::ptrdiff_t>(i) * rs + static_cast<std::ptrdiff_t>(j) * cs];
+    };
+};
+
+// Right-looking blocked Cholesky of the lower triangle of the row-major
+// n x n buffer w, in place. Per block of columns: the diagonal block is
+// factored directly, the panel below it solved row by row on the thread
+// pool, and the trailing lower triangle updated by one syrk.
+template <typename TN>
+bool cholesky_in_place(std::vector<TN>& w, std::size_t n)
+{
+    using std::sqrt;
+
+    const _strided_ref<TN> W{ w.data(), static_cast<std::ptrdiff_t>(n), 1 };
+
+    for (std::size_t k0 = 0; k0 < n; k0 += cholesky_block)
+    {
+        const std::size_t k1 = std::min(n, k0 + cholesky_block);
+
+        for (std::size_t j = k0; j < k1; ++j)
+        {
+            TN d = W(j, j);
+            for (std::size_t p = k0; p < j; ++p) d -= W(j, p) * W(j, p);
+            if (!(d > TN{0})) return false;
+            W(j, j) = sqrt(d);
+
+            for (std::size_t i = j + 1; i < k1; ++i)
+            {
+                TN v = W(i, j);
+                for (std::size_t p = k0; p < j; ++p) v -= W(i, p) * W(j, p);
+                W(i, j) = v / W(j, j);
+            };
+        };
+
+        if (k1 == n) break;
+
+        const std::size_t grain = std::max<std::size_t>(1, seoncore::ops::blas1_grain / ((k1 - k0) * (k1 - k0)));
+        seoncore::parallel::parallel_for(n - k1, grain, [&](std::size_t lo, std::size_t hi)
+        {
+            for (std::size_t i = k1 + lo; i < k1 + hi; ++i)
+                for (std::size_t j = k0; j < k1; ++j)
+                {
+                    TN v = W(i, j);
+                    for (std::size_t p = k0; p < j; ++p) v -= W(i, p) * W(j, p);
+                    W(i, j) = v / W(j, j);
+                };
+        });
+
+        // W22 -= L21 * L21^T
+        const TN* l21 = &W(k1, k0);
+        seoncore::ops::detail::_syrk_lower<TN>(n - k1, k1 - k0, TN{-1}, l21, W.rs, 1, TN{1}, &W(k1, k1), W.rs, 1);
+    };
+
+    return true;
+};
+
+// L * L^T +/- x * x^T by one hyperbolic (downdate) or ordinary (update)
+// rotation per column, applied row-wise so row-major L is read in order.
+// Rotations of a block of columns are found along its diagonal, then
+// applied to all the rows below it in parallel. x is overwritten.
+template <bool Down, typename TN>
+void _cholesky_rank1(_strided_ref<TN> L, std::size_t n, TN* x)
+{
+    using std::sqrt;
+
+    std::vector<TN> c(n);
+    std::vector<TN> s(n);
+    std::vector<TN> c_inv(n);
+
+    auto rotate = [&](std::size_t i, std::size_t k0, std::size_t k1)
+    {
+        TN xi = x[i];
+        for (std::size_t k = k0; k < k1; ++k)
+        {
+            TN& lik = L(i, k);
+            lik = Down ? (lik - s[k] * xi) * c_inv[k] : (lik + s[k] * xi) * c_inv[k];
+            xi = c[k] * xi - s[k] * lik;
+        };
+        x[i] = xi;
+    };
+
+    for (std::size_t k0 = 0; k0 < n; k0 += cholesky_block)
+    {
+        const std::size_t k1 = std::min(n, k0 + cholesky_block);
+
+        for (std::size_t i = k0; i < k1; ++i)
+        {
+            rotate(i, k0, i);
+
+            const TN d = L(i, i);
+            const TN r2 = Down ? d * d - x[i] * x[i] : d * d + x[i] * x[i];
+            assert(r2 > TN{0});
+
+            const TN r = sqrt(r2);
+            c[i] = r / d;
+            c_inv[i] = d / r;
+            s[i] = x[i] / d;
+            L(i, i) = r;
+        };
+
+        const std::size_t grain = std::max<std::size_t>(1, seoncore::ops::blas1_grain / (k1 - k0));
+        seoncore::parallel::parallel_for(n - k1, grain, [&](std::size_t lo, std::size_t hi)
+        {
+            for (std::size_t i = k1 + lo; i < k1 + hi; ++i)
+                rotate(i, k0, k1);
+        });
+    };
+};
+
+template <typename TN, class S>
+_strided_ref<TN> _factor_ref(seoncore::matrix::DenseMatrix<TN, S>& L) noexcept
+{
+    const auto l = seoncore::matrix::_strided_layout(L);
+    return { L.data(), l.rs, l.cs };
+};
+
+}; // namespace detail
+
+// Cholesky factor of a symmetric positive definite matrix; only the lower
+// triangle of `a` is read. The O(n^3) work is in GEMM-backed syrk updates.
+template <seoncore::concepts::MatrixLike A>
+auto cholesky(const A& a)
+{
+    using TN = typename A::value_type;
+
+    assert(a.rows() == a.cols());
+    const std::size_t n = a.rows();
+
+    std::vector<TN> w(n * n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j <= i; ++j)
+            w[i * n + j] = a(i, j);
+
+    Cholesky<TN> out;
+    out.ok = detail::cholesky_in_place(w, n);
+    if (!out.ok) return out;
+
+    for (std::size_t i = 0; i < n; ++i)
+        std::fill(w.begin() + static_cast<std::ptrdiff_t>(i * n + i + 1), w.begin() + static_cast<std::ptrdiff_t>((i + 1) * n), TN{0});
+
+    out.L = seoncore::matrix::DenseMatrix<TN>(w, n, n);
+    return out;
+};
+
+// L becomes the factor of L * L^T + x * x^T, in O(n^2).
+template <typename TN, class S, bool C>
+void cholesky_update(seoncore::matrix::DenseMatrix<TN, S>& L, seoncore::views::BaseVectorView<TN, C> x)
+{
+    assert(L.rows() == L.cols() && L.rows() == x.size());
+
+    std::vector<TN> w(x.begin(), x.end());
+    detail::_cholesky_rank1<false>(detail::_factor_ref(L), L.rows(), w.data());
+};
+
+// L becomes the factor of L * L^T - x * x^T, in O(n^2). Returns false and
+// leaves L unchanged when that matrix is not positive definite, which is
+// checked first through L p = x: it is exactly when |p| >= 1.
+template <typename TN, class S, bool C>
+bool cholesky_downdate(seoncore::matrix::DenseMatrix<TN, S>& L, seoncore::views::BaseVectorView<TN, C> x)
+{
+    assert(L.rows() == L.cols() && L.rows() == x.size());
+
+    const std::size_t n = L.rows();
+    const detail::_strided_ref<TN> R = detail::_factor_ref(L);
+
+    std::vector<TN> p(n);
+    TN pp{0};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        TN v = x[i];
+        for (std::size_t k = 0; k < i; ++k) v -= R(i, k) * p[k];
+        p[i] = v / R(i, i);
+        pp += p[i] * p[i];
+    };
+    if (!(pp < TN{1})) return false;
+
+    std::vector<TN> w(x.begin(), x.end());
+    detail::_cholesky_rank1<true>(R, n, w.data());
+    return true;
+};
+
+}; // namespace seoncore::linalg
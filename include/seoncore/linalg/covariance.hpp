@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <vector>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/strided.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::linalg
+{
+
+// Running mean and covariance of a stream of samples (vectors of length
+// dim). Keeps the count, the mean and the scatter matrix
+// M2 = sum (x - mean) (x - mean)^T, whose lower triangle is the only one
+// maintained, and updates them in O(dim^2) per sample (Welford) instead
+// of recomputing from all samples seen. Two accumulators merge exactly
+// (Chan et al.), which is also how batches are taken in: each chunk of
+// rows is centered on its own mean, reduced by syrk, and merged in.
+template <typename TN>
+class OnlineCovariance
+{
+public:
+    using value_type    = TN;
+    using size_type     = std::size_t;
+
+    explicit OnlineCovariance(size_type dim = 0)
+        : _mean(dim)
+        , _m2(dim, dim)
+    {};
+
+    size_type dim() const noexcept { return _mean.size(); };
+    size_type count() const noexcept { return _count; };
+
+    seoncore::views::VectorView<TN> mean() const noexcept
+    {
+        return seoncore::views::VectorView<TN>(_mean.data(), _mean.size(), 1);
+    };
+
+    // Lower triangle: sum of (x - mean) (x - mean)^T over the samples.
+    const seoncore::matrix::DenseMatrix<TN>& scatter() const noexcept { return _m2; };
+
+    // One sample.
+    template <bool C>
+    OnlineCovariance& push(seoncore::views::BaseVectorView<TN, C> x)
+    {
+        assert(x.size() == dim());
+
+        const size_type n = dim();
+        ++_count;
+
+        std::vector<TN> d(n);
+        const TN inv = TN{1} / static_cast<TN>(_count);
+        for (size_type i = 0; i < n; ++i)
+        {
+            d[i] = x[i] - _mean[i];
+            _mean[i] += d[i] * inv;
+        };
+
+        // (x - old mean) (x - new mean)^T = (count - 1) / count * d d^T
+        const TN f = static_cast<TN>(_count - 1) * inv;
+        TN* m2 = _m2.data();
+        const size_type grain = std::max<size_type>(1, seoncore::ops::blas1_grain / std::max<size_type>(1, n));
+        seoncore::parallel::parallel_for(n, grain, [&](size_type lo, size_type hi)
+        {
+            for (size_type i = lo; i < hi; ++i)
+            {
+                TN* row = m2 + i * n;
+                const TN fi = f * d[i];
+                for (size_type j = 0; j <= i; ++j)
+                    row[j] += fi * d[j];
+            };
+        });
+        return *this;
+    };
+
+    // Every row of X (samples x dim) as a sample. Large batches are cut
+    // into chunks of a size set by dim alone, reduced to partial
+    // accumulators in parallel and merged in order, so the result does not
+    // depend on the thread count.
+    template <seoncore::matrix::StridedDense X>
+    requires std::same_as<typename X::value_type, TN>
+    OnlineCovariance& push(const X& x)
+    {
+        assert(x.cols() == dim());
+
+        const auto l = seoncore::matrix::_strided_layout(x);
+        const size_type rows = l.rows;
+        const size_type chunk = std::max(batch_rows, dim());
+        const size_type chunks = (rows + chunk - 1) / chunk;
+
+        if (chunks <= 1)
+            return merge(_reduce(l, 0, rows, true));
+
+        std::vector<OnlineCovariance> parts(chunks);
+        seoncore::parallel::parallel_for(chunks, 1, [&](size_type lo, size_type hi)
+        {
+            for (size_type c = lo; c < hi; ++c)
+                parts[c] = _reduce(l, c * chunk, std::min(rows, (c + 1) * chunk), false);
+        });
+
+        for (const OnlineCovariance& p : parts)
+            merge(p);
+        return *this;
+    };
+
+    // Combines with an accumulator over other samples of the same dim.
+    OnlineCovariance& merge(const OnlineCovariance& other)
+    {
+        assert(other.dim() == dim());
+
+        if (other._count == 0) return *this;
+        if (_count == 0) return *this = other;
+
+        const size_type n = dim();
+        const TN na = static_cast<TN>(_count);
+        const TN nb = static_cast<TN>(other._count);
+        const TN total = na + nb;
+
+        // M2 = M2a + M2b + na nb / (na + nb) * delta delta^T
+        std::vector<TN> delta(n);
+        for (size_type i = 0; i < n; ++i)
+        {
+            delta[i] = other._mean[i] - _mean[i];
+            _mean[i] += delta[i] * (nb / total);
+        };
+
+        const TN f = na * nb / total;
+        TN* m2 = _m2.data();
+        const TN* o2 = other._m2.data();
+        const size_type grain = std::max<size_type>(1, seoncore::ops::blas1_grain / std::max<size_type>(1, n));
+        seoncore::parallel::parallel_for(n, grain, [&](size_type lo, size_type hi)
+        {
+            for (size_type i = lo; i < hi; ++i)
+            {
+                const TN fi = f * delta[i];
+                for (size_type j = 0; j <= i; ++j)
+                    m2[i * n + j] += o2[i * n + j] + fi * delta[j];
+            };
+        });
+
+        _count += other._count;
+        return *this;
+    };
+
+    // Full symmetric covariance, M2 / (count - ddof); zero with too few
+    // samples.
+    seoncore::matrix::DenseMatrix<TN> covariance(size_type ddof = 1) const
+    {
+        const size_type n = dim();
+        seoncore::matrix::DenseMatrix<TN> out(n, n);
+        if (_count <= ddof) return out;
+
+        const TN inv = TN{1} / static_cast<TN>(_count - ddof);
+        for (size_type i = 0; i < n; ++i)
+            for (size_type j = 0; j <= i; ++j)
+            {
+                const TN v = _m2(i, j) * inv;
+                out(i, j) = v;
+                out(j, i) = v;
+            };
+        return out;
+    };
+
+    // Rows per chunk of a batch, at least dim, so a chunk's syrk outweighs
+    // the O(dim^2) merge that follows it.
+    static constexpr size_type batch_rows = 256;
+
+private:
+    size_type                           _count = 0;
+    std::vector<TN>                     _mean;
+    seoncore::matrix::DenseMatrix<TN>   _m2;            // row-major, lower triangle
+
+    // Accumulator over rows [r0, r1) of x: their mean, then the scatter of
+    // the centered rows as one syrk.
+    static OnlineCovariance _reduce(const seoncore::matrix::StridedLayout<TN>& x, size_type r0, size_type r1, bool parallel)
+    {
+        const size_type n = x.cols;
+        const size_type k = r1 - r0;
+
+        OnlineCovariance out(n);
+        out._count = k;
+        if (k == 0) return out;
+
+        auto at = [&](size_type r, size_type j)
+        {
+            return x.data[static_cast<std::ptrdiff_t>(r) * x.rs + static_cast<std::ptrdiff_t>(j) * x.cs];
+        };
+
+        for (size_type r = r0; r < r1; ++r)
+            for (size_type j = 0; j < n; ++j)
+                out._mean[j] += at(r, j);
+        for (TN& m : out._mean) m /= static_cast<TN>(k);
+
+        std::vector<TN> centered(k * n);
+        for (size_type r = 0; r < k; ++r)
+            for (size_type j = 0; j < n; ++j)
+                centered[r * n + j] = at(r0 + r, j) - out._mean[j];
+
+        // M2 = Xc^T Xc; Xc^T is n x k with element (i, r) at r * n + i.
+        seoncore::ops::detail::_syrk_lower<TN>(n, k, TN{1}, centered.data(), 1, static_cast<std::ptrdiff_t>(n),
+                                               TN{0}, out._m2.data(), static_cast<std::ptrdiff_t>(n), 1, parallel);
+        return out;
+    };
+
+}; // class OnlineCovariance<TN>
+
+}; // namespace seoncore::linalg
@@ -0,0 +1,505 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/ops/gemm.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::linalg
+{
+
+template <typename TN>
+struct SymmetricEigen
+{
+    std::vector<TN>                     values;     // ascending
+    seoncore::matrix::DenseMatrix<TN>   vectors;    // column i pairs with values[i]
+};
+
+namespace detail
+{
+
+// Work on W = V^T, row-major, so that every column sweep of the textbook
+// formulation below (V[k][j] over k) is a contiguous row of W.
+template <typename TN>
+struct _transposed_work
+{
+    std::vector<TN>&    w;
+    std::size_t         n;
+
+    TN& operator()(std::size_t r, std::size_t c) noexcept { return w[c * n + r]; };
+    TN* col(std::size_t c) noexcept { return w.data() + c * n; };
+};
+
+// Columns per panel of the blocked reduction, and reflectors per block
+// when Q is formed from them.
+inline constexpr std::size_t eigen_block = 32;
+
+// Eight independent partial sums, so the loop is not bound by the latency
+// of one accumulator and vectorizes without reassociating.
+template <typename TN>
+TN _dot(const TN* x, const TN* y, std::size_t n) noexcept
+{
+    TN acc[8] = {};
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        for (std::size_t l = 0; l < 8; ++l)
+            acc[l] += x[i + l] * y[i + l];
+    for (; i < n; ++i)
+        acc[0] += x[i] * y[i];
+    return ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+};
+
+// Euclidean norm, scaled so that squaring cannot overflow.
+template <typename TN>
+TN _norm(const TN* x, std::size_t n) noexcept
+{
+    using std::abs;
+    using std::sqrt;
+
+    TN scale{0};
+    for (std::size_t i = 0; i < n; ++i)
+        scale = std::max(scale, abs(x[i]));
+    if (scale == TN{0}) return scale;
+
+    TN ss{0};
+    for (std::size_t i = 0; i < n; ++i)
+        ss += (x[i] / scale) * (x[i] / scale);
+    return scale * sqrt(ss);
+};
+
+// Blocked Householder reduction of the symmetric matrix in V (both
+// triangles) to T = Q^T A Q with Q = H(0) H(1) ... H(n-2), as LAPACK
+// sytrd. Each panel of eigen_block columns is reduced column by column
+// against the matrix as it was before the panel (latrd), with the panel's
+// pending update kept as its reflectors Vp and a matrix Wp; the trailing
+// matrix then takes the whole panel as one GEMM,
+// A22 -= [Vp Wp] [Wp Vp]^T. What stays per column is the O(n^2) product
+// of A22 with the new reflector, which is split over the thread pool.
+//
+// On exit d is the diagonal, e[i] = T(i, i-1) with e[0] = 0, and
+// H(i) = I - tau[i] v v^T with v, leading 1 included, in rows i+1.. of
+// column i of V.
+template <typename TN>
+void tridiagonalize(_transposed_work<TN> V, std::vector<TN>& d, std::vector<TN>& e, std::vector<TN>& tau)
+{
+    using std::hypot;
+
+    const std::size_t n = V.n;
+    std::vector<TN> wp(n * eigen_block);
+    std::vector<TN> t(eigen_block);
+    std::vector<TN> vwv;                // [Vp Wp Vp] below the panel
+
+    e[0] = TN{0};
+    for (std::size_t i0 = 0; i0 + 1 < n; i0 += eigen_block)
+    {
+        const std::size_t nb = std::min(eigen_block, n - 1 - i0);
+        const std::size_t m = n - i0;
+
+        // Column p of Wp over rows r >= i0, at [r - i0].
+        auto wcol = [&](std::size_t p) { return wp.data() + p * m; };
+
+        for (std::size_t p = 0; p < nb; ++p)
+        {
+            const std::size_t c = i0 + p;
+            TN* a = V.col(c);
+
+            // Column c as updated by the panel's earlier reflectors.
+            for (std::size_t q = 0; q < p; ++q)
+            {
+                const TN* vq = V.col(i0 + q);
+                const TN* wq = wcol(q) - i0;
+                const TN wcq = wq[c];
+                const TN vcq = vq[c];
+                for (std::size_t r = c; r < n; ++r)
+                    a[r] -= vq[r] * wcq + wq[r] * vcq;
+            };
+            d[c] = a[c];
+
+            // H(c) takes a[c+1..] to (beta, 0, ..., 0); v = (1, a[c+2..] / (alpha - beta)).
+            const std::size_t len = n - c - 1;
+            const TN alpha = a[c + 1];
+            const TN xnorm = _norm(a + c + 2, len - 1);
+            TN* w = wcol(p) + (c + 1 - i0);
+
+            if (xnorm == TN{0})
+            {
+                tau[c] = TN{0};
+                e[c + 1] = alpha;
+                a[c + 1] = TN{1};
+                std::fill(w, w + len, TN{0});
+                continue;
+            };
+
+            TN beta = hypot(alpha, xnorm);
+            if (alpha >= TN{0}) beta = -beta;
+            tau[c] = (beta - alpha) / beta;
+            e[c + 1] = beta;
+
+            const TN inv = TN{1} / (alpha - beta);
+            for (std::size_t r = c + 2; r < n; ++r)
+                a[r] *= inv;
+            a[c + 1] = TN{1};
+
+            // w = A22 v over rows c+1.., by symmetry one contiguous dot per row.
+            const TN* v = a + c + 1;
+            const std::size_t grain = std::max<std::size_t>(1, seoncore::ops::blas1_grain / len);
+            seoncore::parallel::parallel_for(len, grain, [&](std::size_t lo, std::size_t hi)
+            {
+                for (std::size_t r = lo; r < hi; ++r)
+                    w[r] = _dot(V.col(c + 1 + r) + c + 1, v, len);
+            });
+
+            // w -= Vp (Wp^T v) + Wp (Vp^T v), over the panel's earlier columns.
+            for (std::size_t q = 0; q < p; ++q)
+                t[q] = _dot(wcol(q) + (c + 1 - i0), v, len);
+            for (std::size_t q = 0; q < p; ++q)
+            {
+                const TN* vq = V.col(i0 + q) + c + 1;
+                for (std::size_t r = 0; r < len; ++r)
+                    w[r] -= vq[r] * t[q];
+            };
+            for (std::size_t q = 0; q < p; ++q)
+                t[q] = _dot(V.col(i0 + q) + c + 1, v, len);
+            for (std::size_t q = 0; q < p; ++q)
+            {
+                const TN* wq = wcol(q) + (c + 1 - i0);
+                for (std::size_t r = 0; r < len; ++r)
+                    w[r] -= wq[r] * t[q];
+            };
+
+            // w = tau w - (tau^2 / 2) (w^T v) v
+            for (std::size_t r = 0; r < len; ++r)
+                w[r] *= tau[c];
+            const TN half = -TN{0.5} * tau[c] * _dot(w, v, len);
+            for (std::size_t r = 0; r < len; ++r)
+                w[r] += half * v[r];
+        };
+
+        // A22 -= [Vp Wp] [Wp Vp]^T over rows and columns i1.., both
+        // triangles; the two operands are overlapping column ranges of
+        // [Vp Wp Vp].
+        const std::size_t i1 = i0 + nb;
+        const std::size_t m2 = n - i1;
+        vwv.resize(m2 * 3 * nb);
+        for (std::size_t q = 0; q < nb; ++q)
+        {
+            const TN* vq = V.col(i0 + q) + i1;
+            std::copy_n(vq, m2, vwv.data() + q * m2);
+            std::copy_n(wcol(q) + (i1 - i0), m2, vwv.data() + (nb + q) * m2);
+            std::copy_n(vq, m2, vwv.data() + (2 * nb + q) * m2);
+        };
+
+        const std::ptrdiff_t ld = static_cast<std::ptrdiff_t>(m2);
+        seoncore::ops::gemm<TN>(m2, m2, 2 * nb, TN{-1},
+                                vwv.data(), 1, ld,
+                                vwv.data() + nb * m2, ld, 1,
+                                TN{1}, V.col(i1) + i1, 1, static_cast<std::ptrdiff_t>(n));
+    };
+
+    d[n - 1] = V(n - 1, n - 1);
+};
+
+// Q = H(0) H(1) ... H(n-2) from the reflectors tridiagonalize leaves in V,
+// built by applying them to the identity a block at a time, last block
+// first. A block is I - Y T Y^T (compact WY, T upper triangular), applied
+// as two GEMMs; block j0.. only reaches rows and columns j0+1.. of Q.
+template <typename TN>
+void form_q(_transposed_work<TN> V, const std::vector<TN>& tau, std::vector<TN>& q)
+{
+    const std::size_t n = V.n;
+    const std::ptrdiff_t ld = static_cast<std::ptrdiff_t>(n);
+
+    q.assign(n * n, TN{0});
+    for (std::size_t i = 0; i < n; ++i)
+        q[i * n + i] = TN{1};
+
+    const std::size_t reflectors = n - 1;
+    std::vector<TN> y;
+    std::vector<TN> z;
+    std::vector<TN> t(eigen_block * eigen_block);
+
+    for (std::size_t b = (reflectors + eigen_block - 1) / eigen_block; b-- > 0;)
+    {
+        const std::size_t j0 = b * eigen_block;
+        const std::size_t nb = std::min(eigen_block, reflectors - j0);
+        const std::size_t m = n - j0 - 1;
+
+        // Y (m x nb, column-major) holds the block's reflectors over rows
+        // j0+1.., with the zeros above each leading 1.
+        y.assign(m * nb, TN{0});
+        for (std::size_t p = 0; p < nb; ++p)
+            std::copy(V.col(j0 + p) + j0 + p + 1, V.col(j0 + p) + n, y.data() + p * m + p);
+
+        // T(p, p) = tau_p, T(0:p, p) = -tau_p T(0:p, 0:p) Y(:, 0:p)^T y_p
+        for (std::size_t p = 0; p < nb; ++p)
+        {
+            const TN tp = tau[j0 + p];
+            const TN* yp = y.data() + p * m;
+            for (std::size_t k = 0; k < p; ++k)
+                t[p * nb + k] = -tp * _dot(y.data() + k * m + p, yp + p, m - p);
+            for (std::size_t k = 0; k < p; ++k)
+            {
+                TN acc{0};
+                for (std::size_t s = k; s < p; ++s)
+                    acc += t[s * nb + k] * t[p * nb + s];
+                t[p * nb + k] = acc;
+            };
+            t[p * nb + p] = tp;
+        };
+
+        // Q22 -= Y (T (Y^T Q22))
+        TN* q22 = q.data() + (j0 + 1) * n + (j0 + 1);
+        const std::ptrdiff_t lm = static_cast<std::ptrdiff_t>(m);
+        const std::ptrdiff_t lb = static_cast<std::ptrdiff_t>(nb);
+        z.resize(nb * m);
+        seoncore::ops::gemm<TN>(nb, m, m, TN{1}, y.data(), lm, 1, q22, 1, ld, TN{0}, z.data(), 1, lb);
+
+        for (std::size_t col = 0; col < m; ++col)
+        {
+            TN* zc = z.data() + col * nb;
+            for (std::size_t k = 0; k < nb; ++k)
+            {
+                TN acc{0};
+                for (std::size_t s = k; s < nb; ++s)
+                    acc += t[s * nb + k] * zc[s];
+                zc[k] = acc;
+            };
+        };
+
+        seoncore::ops::gemm<TN>(m, m, nb, TN{-1}, y.data(), 1, lm, z.data(), 1, lb, TN{1}, q22, 1, ld);
+    };
+};
+
+// QL sweeps whose rotations are applied to V in one pass, and the rows
+// of V a thread carries through such a pass at a time.
+inline constexpr std::size_t ql_batch = 16;
+inline constexpr std::size_t ql_rows = 128;
+
+// Applies `count` queued QL sweeps to V. Sweep j rotates columns i and i+1
+// by (c[j n + i], s[j n + i]) for i = m[j]-1 down to l[j], and the sweeps
+// must act in order. Rotation i of sweep j+1 only has to wait for rotation
+// i-1 of sweep j, so the sweeps advance as a wavefront two columns apart:
+// at step k sweep j is at column top + 2j - k. A band of ql_rows rows then
+// keeps about 2 * count columns in cache and goes through all the sweeps
+// with one read of V, instead of one per sweep; bands run in parallel.
+template <typename TN>
+void _apply_sweeps(_transposed_work<TN> V, std::size_t count,
+                   const std::size_t* l, const std::size_t* m, const TN* c, const TN* s)
+{
+    const std::size_t n = V.n;
+    std::size_t low = n;
+    std::size_t top = 0;
+    for (std::size_t j = 0; j < count; ++j)
+    {
+        low = std::min(low, l[j]);
+        top = std::max(top, m[j] - 1);
+    };
+    const std::size_t steps = top - low + 2 * count - 1;
+
+    auto band = [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t k = 0; k < steps; ++k)
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                if (top + 2 * j < k) continue;
+                const std::size_t i = top + 2 * j - k;
+                if (i < l[j] || i >= m[j]) continue;
+
+                TN* vi  = V.col(i);
+                TN* vi1 = V.col(i + 1);
+                const TN ci = c[j * n + i];
+                const TN si = s[j * n + i];
+                for (std::size_t r = lo; r < hi; ++r)
+                {
+                    const TN t = vi1[r];
+                    vi1[r] = si * vi[r] + ci * t;
+                    vi[r]  = ci * vi[r] - si * t;
+                };
+            };
+    };
+
+    std::size_t rotations = 0;
+    for (std::size_t j = 0; j < count; ++j)
+        rotations += m[j] - l[j];
+
+    const std::size_t grain = std::max<std::size_t>(1, seoncore::ops::blas1_grain / rotations);
+    seoncore::parallel::parallel_for(n, grain, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t b = lo; b < hi; b += ql_rows)
+            band(b, std::min(hi, b + ql_rows));
+    });
+};
+
+// Implicit QL iteration on the tridiagonal (d, e) (EISPACK tql2). The
+// recurrence on (d, e) never reads V, so with `vectors` set the plane
+// rotations of each sweep are only recorded, and V is rotated once per
+// ql_batch sweeps (see _apply_sweeps).
+template <typename TN>
+void tridiagonal_ql(_transposed_work<TN> V, std::vector<TN>& d, std::vector<TN>& e, bool vectors)
+{
+    using std::abs;
+    using std::hypot;
+
+    const std::size_t n = V.n;
+    const TN eps = std::numeric_limits<TN>::epsilon();
+
+    for (std::size_t i = 1; i < n; ++i)
+        e[i - 1] = e[i];
+    e[n - 1] = TN{0};
+
+    TN f{0};
+    TN tst1{0};
+    std::vector<TN> rot_c(vectors ? ql_batch * n : 0);
+    std::vector<TN> rot_s(vectors ? ql_batch * n : 0);
+    std::size_t sweep_l[ql_batch];
+    std::size_t sweep_m[ql_batch];
+    std::size_t queued = 0;
+
+    for (std::size_t l = 0; l < n; ++l)
+    {
+        tst1 = std::max(tst1, abs(d[l]) + abs(e[l]));
+
+        std::size_t m = l;
+        while (m < n - 1 && abs(e[m]) > eps * tst1)
+            ++m;
+
+        if (m > l)
+        {
+            do
+            {
+                TN g = d[l];
+                TN p = (d[l + 1] - g) / (TN{2} * e[l]);
+                TN r = hypot(p, TN{1});
+                if (p < TN{0}) r = -r;
+
+                d[l] = e[l] / (p + r);
+                d[l + 1] = e[l] * (p + r);
+                const TN dl1 = d[l + 1];
+                TN h = g - d[l];
+                for (std::size_t i = l + 2; i < n; ++i)
+                    d[i] -= h;
+                f += h;
+
+                p = d[m];
+                TN c{1}, c2{1}, c3{1};
+                const TN el1 = e[l + 1];
+                TN s{0}, s2{0};
+
+                for (std::size_t i = m; i-- > l;)
+                {
+                    c3 = c2;
+                    c2 = c;
+                    s2 = s;
+                    g = c * e[i];
+                    h = c * p;
+                    r = hypot(p, e[i]);
+                    e[i + 1] = s * r;
+                    s = e[i] / r;
+                    c = p / r;
+                    p = c * d[i] - s * g;
+                    d[i + 1] = h + s * (c * g + s * d[i]);
+
+                    if (vectors)
+                    {
+                        rot_c[queued * n + i] = c;
+                        rot_s[queued * n + i] = s;
+                    };
+                };
+
+                if (vectors)
+                {
+                    sweep_l[queued] = l;
+                    sweep_m[queued] = m;
+                    if (++queued == ql_batch)
+                    {
+                        _apply_sweeps(V, queued, sweep_l, sweep_m, rot_c.data(), rot_s.data());
+                        queued = 0;
+                    };
+                };
+
+                p = -s * s2 * c3 * el1 * e[l] / dl1;
+                e[l] = s * p;
+                d[l] = c * p;
+            }
+            while (abs(e[l]) > eps * tst1);
+        };
+
+        d[l] += f;
+        e[l] = TN{0};
+    };
+
+    if (queued > 0)
+        _apply_sweeps(V, queued, sweep_l, sweep_m, rot_c.data(), rot_s.data());
+};
+
+}; // namespace detail
+
+// Eigen-decomposition of a symmetric matrix: Householder tridiagonalization
+// followed by implicit QL. Only the lower triangle of `a` is read. With
+// `vectors == false` the O(n^3) accumulation of the transforms is skipped.
+template <seoncore::concepts::MatrixLike A>
+auto eigh(const A& a, bool vectors = true)
+{
+    using TN = typename A::value_type;
+
+    assert(a.rows() == a.cols());
+    const std::size_t n = a.rows();
+
+    SymmetricEigen<TN> out;
+    if (n == 0) return out;
+
+    // Only the lower triangle is read; in W = V^T that is the upper one.
+    std::vector<TN> w(n * n);
+    detail::_transposed_work<TN> V { w, n };
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            V(i, j) = a(i, j);
+            V(j, i) = a(i, j);
+        };
+
+    std::vector<TN> d(n);
+    std::vector<TN> e(n);
+    std::vector<TN> tau(n);
+
+    detail::tridiagonalize(V, d, e, tau);
+    if (vectors)
+    {
+        std::vector<TN> q;
+        detail::form_q(V, tau, q);
+        w.swap(q);
+    };
+    detail::tridiagonal_ql(V, d, e, vectors);
+
+    std::vector<std::size_t> order(n);
+    for (std::size_t i = 0; i < n; ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return d[x] < d[y]; });
+
+    out.values.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+        out.values[i] = d[order[i]];
+
+    if (vectors)
+    {
+        // Eigenvector i is row order[i] of W; stacking those rows gives a
+        // column-major matrix whose columns are the eigenvectors.
+        std::vector<TN> sorted(n * n);
+        for (std::size_t i = 0; i < n; ++i)
+            std::copy_n(w.data() + order[i] * n, n, sorted.data() + i * n);
+
+        out.vectors = seoncore::matrix::DenseMatrix<TN>(sorted, n, n, seoncore::enums::Major::Column);
+    };
+
+    return out;
+};
+
+}; // namespace seoncore::linalg
@@ -0,0 +1,5 @@
+#pragma once
+#include <seoncore/linalg/cholesky.hpp>
+#include <seoncore/linalg/covariance.hpp>
+#include <seoncore/linalg/eigen.hpp>
+#include <seoncore/linalg/svd.hpp>
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::linalg
+{
+
+// A ~= U * diag(S) * V^T, singular values descending. U is m x r and V is
+// n x r, both with orthonormal columns (a column paired with a zero
+// singular value is left as zero).
+template <typename TN>
+struct SVD
+{
+    seoncore::matrix::DenseMatrix<TN>   U;
+    std::vector<TN>                     S;
+    seoncore::matrix::DenseMatrix<TN>   V;
+};
+
+struct RandomizedSVDOptions
+{
+    std::size_t     oversample          = 10;
+    std::size_t     power_iterations    = 2;
+    std::uint64_t   seed                = 0x5e0c0de;
+};
+
+namespace detail
+{
+
+// In-place orthonormalization of the `cols` contiguous columns of length
+// `rows` in q (column-major), by modified Gram-Schmidt applied twice.
+// Columns that are numerically dependent on the earlier ones are zeroed.
+template <typename TN>
+void orthonormalize_columns(std::vector<TN>& q, std::size_t rows, std::size_t cols)
+{
+    using seoncore::views::VectorView;
+    using seoncore::views::MutableVectorView;
+
+    for (std::size_t j = 0; j < cols; ++j)
+    {
+        MutableVectorView<TN> qj(q.data() + j * rows, rows, 1);
+        const TN before = seoncore::ops::nrm2(qj);
+
+        for (int pass = 0; pass < 2; ++pass)
+            for (std::size_t i = 0; i < j; ++i)
+            {
+                VectorView<TN> qi(q.data() + i * rows, rows, 1);
+                seoncore::ops::axpy(-seoncore::ops::dot(qi, qj), qi, qj);
+            };
+
+        const TN after = seoncore::ops::nrm2(qj);
+        if (after > before * std::numeric_limits<TN>::epsilon() * TN{16} && after > TN{0})
+            seoncore::ops::scal(TN{1} / after, qj);
+        else
+            seoncore::ops::fill(qj, TN{0});
+    };
+};
+
+// One-sided Jacobi (Hestenes) on the n columns of a (column-major m x n,
+// m >= n). Columns are rotated pairwise until mutually orthogonal, in
+// round-robin order so each round's n/2 rotations are independent and
+// run on the thread pool. On exit column j of a is sigma_j * u_j and v
+// (column-major n x n) holds the accumulated rotations.
+template <typename TN>
+void one_sided_jacobi(std::vector<TN>& a, std::vector<TN>& v, std::size_t m, std::size_t n)
+{
+    using std::abs;
+    using std::sqrt;
+
+    const TN eps = std::numeric_limits<TN>::epsilon();
+    const std::size_t players = n + (n & 1);
+    const std::size_t max_sweeps = 60;
+
+    std::vector<std::size_t> ring(players);
+    for (std::size_t i = 0; i < players; ++i) ring[i] = i;
+
+    for (std::size_t sweep = 0; sweep < max_sweeps; ++sweep)
+    {
+        bool rotated = false;
+
+        for (std::size_t round = 0; round + 1 < players; ++round)
+        {
+            bool round_rotated = false;
+
+            seoncore::parallel::parallel_for(players / 2, 1, [&](std::size_t lo, std::size_t hi)
+            {
+                bool any = false;
+                for (std::size_t t = lo; t < hi; ++t)
+                {
+                    std::size_t p = ring[t];
+                    std::size_t q = ring[players - 1 - t];
+                    if (p >= n || q >= n) continue;
+                    if (p > q) std::swap(p, q);
+
+                    TN* ap = a.data() + p * m;
+                    TN* aq = a.data() + q * m;
+
+                    TN alpha{0}, beta{0}, gamma{0};
+                    for (std::size_t k = 0; k < m; ++k)
+                    {
+                        alpha += ap[k] * ap[k];
+                        beta  += aq[k] * aq[k];
+                        gamma += ap[k] * aq[k];
+                    };
+
+                    if (gamma == TN{0} || abs(gamma) <= eps * sqrt(alpha * beta))
+                        continue;
+
+                    const TN zeta = (beta - alpha) / (TN{2} * gamma);
+                    const TN tau = ((zeta >= TN{0}) ? TN{1} : TN{-1}) / (abs(zeta) + sqrt(TN{1} + zeta * zeta));
+                    const TN c = TN{1} / sqrt(TN{1} + tau * tau);
+                    const TN s = c * tau;
+
+                    for (std::size_t k = 0; k < m; ++k)
+                    {
+                        const TN x = ap[k];
+                        const TN y = aq[k];
+                        ap[k] = c * x - s * y;
+                        aq[k] = s * x + c * y;
+                    };
+
+                    TN* vp = v.data() + p * n;
+                    TN* vq = v.data() + q * n;
+                    for (std::size_t k = 0; k < n; ++k)
+                    {
+                        const TN x = vp[k];
+                        const TN y = vq[k];
+                        vp[k] = c * x - s * y;
+                        vq[k] = s * x + c * y;
+                    };
+
+                    any = true;
+                };
+
+                if (any) std::atomic_ref<bool>(round_rotated).store(true, std::memory_order_relaxed);
+            });
+
+            rotated = rotated || round_rotated;
+
+            // Circle method: keep ring[0] fixed, rotate the rest by one.
+            std::rotate(ring.begin() + 1, ring.end() - 1, ring.end());
+        };
+
+        if (!rotated) break;
+    };
+};
+
+// Thin SVD of a column-major m x n buffer with m >= n.
+template <typename TN>
+SVD<TN> thin_svd_tall(std::vector<TN> a, std::size_t m, std::size_t n)
+{
+    std::vector<TN> v(n * n, TN{0});
+    for (std::size_t i = 0; i < n; ++i) v[i * n + i] = TN{1};
+
+    one_sided_jacobi(a, v, m, n);
+
+    std::vector<TN> sigma(n);
+    for (std::size_t j = 0; j < n; ++j)
+        sigma[j] = seoncore::ops::nrm2(seoncore::views::VectorView<TN>(a.data() + j * m, m, 1));
+
+    std::vector<std::size_t> order(n);
+    for (std::size_t j = 0; j < n; ++j) order[j] = j;
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return sigma[x] > sigma[y]; });
+
+    std::vector<TN> u_out(m * n);
+    std::vector<TN> v_out(n * n);
+    SVD<TN> out;
+    out.S.resize(n);
+
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        const std::size_t src = order[j];
+        const TN s = sigma[src];
+        out.S[j] = s;
+
+        const TN inv = (s > TN{0}) ? TN{1} / s : TN{0};
+        for (std::size_t k = 0; k < m; ++k)
+            u_out[j * m + k] = a[src * m + k] * inv;
+
+        std::copy_n(v.data() + src * n, n, v_out.data() + j * n);
+    };
+
+    out.U = seoncore::matrix::DenseMatrix<TN>(u_out, m, n, seoncore::enums::Major::Column);
+    out.V = seoncore::matrix::DenseMatrix<TN>(v_out, n, n, seoncore::enums::Major::Column);
+    return out;
+};
+
+template <typename TN>
+SVD<TN> truncate(SVD<TN> full, std::size_t k)
+{
+    const std::size_t r = full.S.size();
+    if (k >= r) return full;
+
+    auto first_cols = [k](const seoncore::matrix::DenseMatrix<TN>& M)
+    {
+        seoncore::matrix::DenseMatrix<TN> out(M.rows(), k);
+        for (std::size_t i = 0; i < M.rows(); ++i)
+            for (std::size_t j = 0; j < k; ++j)
+                out(i, j) = M(i, j);
+        return out;
+    };
+
+    SVD<TN> out;
+    out.U = first_cols(full.U);
+    out.V = first_cols(full.V);
+    out.S.assign(full.S.begin(), full.S.begin() + static_cast<std::ptrdiff_t>(k));
+    return out;
+};
+
+// Column-major copy of (optionally transposed) a.
+template <seoncore::concepts::MatrixLike A>
+auto column_major_copy(const A& a, bool transpose)
+{
+    using TN = typename A::value_type;
+
+    const std::size_t m = transpose ? a.cols() : a.rows();
+    const std::size_t n = transpose ? a.rows() : a.cols();
+    std::vector<TN> out(m * n);
+
+    for (std::size_t j = 0; j < n; ++j)
+        for (std::size_t i = 0; i < m; ++i)
+            out[j * m + i] = transpose ? a(j, i) : a(i, j);
+
+    return out;
+};
+
+}; // namespace detail
+
+// Thin SVD by one-sided Jacobi: r = min(m, n) singular triplets, accurate
+// to working precision even for small singular values.
+template <seoncore::concepts::MatrixLike A>
+auto svd(const A& a)
+{
+    using TN = typename A::value_type;
+
+    const std::size_t m = a.rows();
+    const std::size_t n = a.cols();
+
+    if (m >= n)
+        return detail::thin_svd_tall<TN>(detail::column_major_copy(a, false), m, n);
+
+    // A^T = U' S V'^T  =>  A = V' S U'^T
+    SVD<TN> t = detail::thin_svd_tall<TN>(detail::column_major_copy(a, true), n, m);
+    std::swap(t.U, t.V);
+    return t;
+};
+
+// The k leading singular triplets, computed exactly.
+template <seoncore::concepts::MatrixLike A>
+auto truncated_svd(const A& a, std::size_t k)
+{
+    return detail::truncate(svd(a), k);
+};
+
+// Randomized range finder (Halko, Martinsson & Tropp) for the k leading
+// singular triplets. All passes over A are GEMMs through ops::matmul:
+//   Y = A * Omega, with `power_iterations` rounds of Y = A * (A^T * Q),
+//   Q = orth(Y), B = Q^T * A, then an exact SVD of the small B.
+// A^T * Q is formed as (Q^T * A)^T so A is never transposed.
+template <typename TN>
+SVD<TN> randomized_svd(
+    const seoncore::matrix::DenseMatrix<TN>& A,
+    std::size_t k,
+    RandomizedSVDOptions opts = {})
+{
+    using Dense = seoncore::matrix::DenseMatrix<TN>;
+    using seoncore::enums::Major;
+
+    const std::size_t m = A.rows();
+    const std::size_t n = A.cols();
+    const std::size_t l = std::min(k + opts.oversample, std::min(m, n));
+
+    Dense omega(n, l);
+    {
+        std::mt19937_64 gen(opts.seed);
+        std::normal_distribution<double> normal(0.0, 1.0);
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < l; ++j)
+                omega(i, j) = static_cast<TN>(normal(gen));
+    };
+
+    // Orthonormal column-major basis of the columns of Y, returned both as
+    // Q (m x l) and, sharing the same buffer layout, as Q^T (l x m).
+    auto orth = [](const Dense& Y, std::vector<TN>& q)
+    {
+        q = detail::column_major_copy(Y, false);
+        detail::orthonormalize_columns(q, Y.rows(), Y.cols());
+    };
+
+    std::vector<TN> q;
+    orth(seoncore::ops::matmul(A, omega), q);
+
+    for (std::size_t it = 0; it < opts.power_iterations; ++it)
+    {
+        const Dense Qt(q, l, m, Major::Row);
+        const Dense QtA = seoncore::ops::matmul(Qt, A);        // l x n
+
+        std::vector<TN> z = detail::column_major_copy(QtA, true);
+        detail::orthonormalize_columns(z, n, l);
+        const Dense Z(z, n, l, Major::Column);
+
+        orth(seoncore::ops::matmul(A, Z), q);
+    };
+
+    const Dense Qt(q, l, m, Major::Row);
+    const Dense B = seoncore::ops::matmul(Qt, A);               // l x n
+
+    SVD<TN> small = svd(B);                                     // U: l x l, V: n x l
+    const Dense Q(q, m, l, Major::Column);
+
+    SVD<TN> out;
+    out.U = seoncore::ops::matmul(Q, small.U);
+    out.S = std::move(small.S);
+    out.V = std::move(small.V);
+
+    return detail::truncate(std::move(out), k);
+};
+
+}; // namespace seoncore::linalg
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include <seoncore/matrix/base.hpp>
+#include <seoncore/matrix/structured_ref.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/views/transposed.hpp>
+
+namespace seoncore::matrix
+{
+
+// rows x cols matrix with `kl` sub- and `ku` super-diagonals. Storage is
+// row-wise band storage: row i keeps the kl + ku + 1 slots for columns
+// i - kl .. i + ku, so a row of the band is one contiguous run. Slots that
+// fall outside the matrix are left as zero padding. Entries outside the
+// band read as zero; writing anything but zero to them is rejected (see
+// StructuredRef).
+template <typename TN>
+class BandedMatrix : public BaseMatrix<BandedMatrix<TN>, TN>
+{
+public:
+    friend struct BaseMatrix<BandedMatrix<TN>, TN>;
+
+    using self                  = BandedMatrix<TN>;
+    using size_type             = std::size_t;
+    using value_type            = TN;
+    using type                  = TN;
+    using reference             = StructuredRef<TN>;
+    using const_ref             = const TN&;
+    using pointer               = TN*;
+    using const_ptr             = const TN*;
+    using vec_view              = seoncore::views::VectorView<TN>;
+    using mut_vec_view          = seoncore::views::MutableVectorView<TN>;
+
+    constexpr BandedMatrix() noexcept = default;
+
+    constexpr BandedMatrix(size_type rows, size_type cols, size_type kl, size_type ku)
+        : _band(rows * (kl + ku + 1))
+        , _rows(rows)
+        , _cols(cols)
+        , _kl(kl)
+        , _ku(ku)
+    {};
+
+    constexpr bool operator==(const BandedMatrix& other) const noexcept
+    {
+        return _band == other._band &&
+               _rows == other._rows &&
+               _cols == other._cols &&
+               _kl   == other._kl   &&
+               _ku   == other._ku;
+    };
+
+    constexpr bool operator!=(const BandedMatrix& other) const noexcept { return !(*this == other); };
+
+    constexpr size_type lower_bandwidth() const noexcept { return _kl; };
+    constexpr size_type upper_bandwidth() const noexcept { return _ku; };
+
+    constexpr bool in_band(size_type i, size_type j) const noexcept
+    {
+        return i < _rows && j < _cols && j + _kl >= i && j <= i + _ku;
+    };
+
+    // Columns [first, last) of row i that lie inside the band.
+    constexpr size_type row_first(size_type i) const noexcept { return (i > _kl) ? i - _kl : 0; };
+    constexpr size_type row_last(size_type i) const noexcept { return std::min(_cols, i + _ku + 1); };
+
+    // Band entries of row i, starting at column row_first(i).
+    constexpr const_ptr row_band(size_type i) const noexcept
+    {
+        return _band.data() + _index(i, row_first(i));
+    };
+
+private:
+    static constexpr TN _zero{};
+
+    std::vector<TN>     _band;
+    size_type           _rows = 0;
+    size_type           _cols = 0;
+    size_type           _kl = 0;
+    size_type           _ku = 0;
+
+    constexpr size_type _index(size_type i, size_type j) const noexcept
+    {
+        return i * (_kl + _ku + 1) + (j + _kl - i);
+    };
+
+    constexpr size_type rows_impl() const noexcept { return _rows; };
+    constexpr size_type cols_impl() const noexcept { return _cols; };
+
+    constexpr pointer data_impl() { return _band.data(); };
+    constexpr const_ptr data_impl() const { return _band.data(); };
+
+    constexpr reference at_impl(size_type i, size_type j) noexcept
+    {
+        return reference(in_band(i, j) ? &_band[_index(i, j)] : nullptr);
+    };
+
+    constexpr const_ref at_impl(size_type i, size_type j) const noexcept
+    {
+        return in_band(i, j) ? _band[_index(i, j)] : _zero;
+    };
+
+    constexpr seoncore::views::MutableTransposedView<self>
+    transposed_impl() noexcept { return seoncore::views::MutableTransposedView<self>(*this); };
+
+    constexpr seoncore::views::TransposedView<self>
+    transposed_impl() const noexcept { return seoncore::views::TransposedView<self>(*this); };
+
+}; // class BandedMatrix<TN>
+
+}; // namespace seoncore::matrix
+
+#include <seoncore/ops/structured_ops.hpp>
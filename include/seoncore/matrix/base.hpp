@@ -32,7 +32,8 @@ public:
 
     constexpr std::pair<size_type, size_type> shape() const { return { rows(), cols() }; };
 
-    constexpr reference at(size_type i, size_type j) { return derived().at_impl(i, j); };
+    // TN& for dense storage, a proxy (StructuredRef) for structured types.
+    constexpr decltype(auto) at(size_type i, size_type j) { return derived().at_impl(i, j); };
     constexpr const_ref at(size_type i, size_type j) const { return derived().at_impl(i, j); };
 
     constexpr pointer data()         { return derived().data_impl(); };
@@ -49,7 +50,7 @@ public:
 
     constexpr size_type size() const { return rows() * cols(); };
 
-    constexpr reference operator()(size_type i, size_type j)       { return at(i, j); };
+    constexpr decltype(auto) operator()(size_type i, size_type j) { return at(i, j); };
     constexpr const_ref operator()(size_type i, size_type j) const { return at(i, j); };
 
     constexpr seoncore::views::MutableVectorView<TN> row(size_type i) noexcept { return derived().row_impl(i); }; 
@@ -2,20 +2,27 @@
 
 #include <vector>
 #include <seoncore/enums/major.hpp>
+#include <seoncore/concepts/storage.hpp>
+#include <seoncore/matrix/dense_fwd.hpp>
 #include <seoncore/matrix/base.hpp>
 #include <seoncore/views/vec.hpp>
 #include <seoncore/views/transposed.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
 
 namespace seoncore::matrix
 {
 
-template <typename TN>
-class DenseMatrix : public BaseMatrix<DenseMatrix<TN>, TN>
+template <typename TN, class Storage>
+class DenseMatrix : public BaseMatrix<DenseMatrix<TN, Storage>, TN>
 {
+    static_assert(seoncore::concepts::DenseStorage<Storage>);
+
 public:
-    friend struct BaseMatrix<DenseMatrix<TN>, TN>;
+    friend struct BaseMatrix<DenseMatrix<TN, Storage>, TN>;
 
-    using self                  = DenseMatrix<TN>;
+    using self                  = DenseMatrix<TN, Storage>;
+    using storage_type          = Storage;
     using size_type             = std::size_t;
     using value_type            = TN;
     using type                  = TN;
@@ -29,26 +36,33 @@ public:
     constexpr DenseMatrix() noexcept = default;
     constexpr ~DenseMatrix() noexcept = default;
 
+    // The buffer is copied in the body so the "copy" scope times it.
     constexpr DenseMatrix(const DenseMatrix& other) noexcept
-        : _data(other._data)
-        , _rows(other._rows)
+        : _rows(other._rows)
         , _cols(other._cols)
         , _sr(other._sr)
         , _sc(other._sc)
         , _major(other._major)
-    {};
+    {
+        SEONCORE_OP_SCOPE("copy", seoncore::enums::Path::Direct, _rows, _cols, 0, 0, _copy_bytes());
+        _data = other._data;
+        _count_copy();
+    };
 
     constexpr DenseMatrix& operator=(const DenseMatrix& other) noexcept
     {
         if (this == &other) return *this;
 
-        _data   = other._data; 
         _rows   = other._rows; 
         _cols   = other._cols; 
         _sr     = other._sr; 
         _sc     = other._sc;
         _major  = other._major;
 
+        SEONCORE_OP_SCOPE("copy", seoncore::enums::Path::Direct, _rows, _cols, 0, 0, _copy_bytes());
+        _data   = other._data; 
+        _count_copy();
+
         return *this;
     };
 
@@ -78,7 +92,7 @@ public:
         return *this;
     };
 
-    constexpr bool operator==(const DenseMatrix<TN>& other) noexcept
+    constexpr bool operator==(const DenseMatrix& other) noexcept
     {
         return _data    == other._data &&
                _rows    == other._rows &&
@@ -88,7 +102,7 @@ public:
                _major   == other._major;
     };
 
-    constexpr bool operator!=(const DenseMatrix<TN>& other) noexcept { return !(*this == other); };
+    constexpr bool operator!=(const DenseMatrix& other) noexcept { return !(*this == other); };
 
     constexpr DenseMatrix(
             const_ref begin, 
@@ -102,6 +116,7 @@ public:
         , _major(major)
     {
         _init_strides();
+        _count_alloc();
     };
 
     constexpr DenseMatrix(
@@ -109,42 +124,51 @@ public:
             size_type rows,
             size_type cols,
             seoncore::enums::Major major = seoncore::enums::Major::Row) noexcept
-        : _data(raw_data)
+        : _data(raw_data.begin(), raw_data.end())
         , _rows(rows)
         , _cols(cols)
         , _major(major)
     {
         assert(raw_data.size() == rows * cols);
-        _init_strides(); 
+        _init_strides();
+        _count_alloc();
     };
 
     constexpr DenseMatrix(
             size_type rows,
             size_type cols,
             seoncore::enums::Major major = seoncore::enums::Major::Row) noexcept
-        : _data(std::vector<TN>(rows * cols))
+        : _data(rows * cols)
         , _rows(rows)
         , _cols(cols)
         , _major(major)
     {
         _init_strides();
+        _count_alloc();
     };
 
     constexpr DenseMatrix(
             const std::vector<std::vector<TN>>& data,
             seoncore::enums::Major major = seoncore::enums::Major::Row) noexcept
-        : _major(major)
+        : _data(data.empty() ? 0 : data.size() * data[0].size())
+        , _major(major)
     {
         assert(!data.empty());
 
         _rows = data.size();
         _cols = data[0].size();
 
+        pointer out = _data.data();
         for (auto& row : data)
+        {
+            assert(_cols == row.size());
+
             for (auto& elem : row)
-                _data.push_back(elem);
+                *out++ = elem;
+        };
 
         _init_strides();
+        _count_alloc();
     };
 
     constexpr DenseMatrix(
@@ -152,50 +176,47 @@ public:
             size_type rows, 
             size_type cols,
             seoncore::enums::Major major = seoncore::enums::Major::Row) noexcept
-        : _rows(rows)
+        : _data(raw_ilist.begin(), raw_ilist.end())
+        , _rows(rows)
         , _cols(cols)
         , _major(major)
     {
         assert(raw_ilist.size() == rows * cols);
 
-        for (auto& elem : raw_ilist)
-            _data.push_back(elem);
-
         _init_strides();
+        _count_alloc();
     };
 
     constexpr DenseMatrix(
             const std::initializer_list<std::initializer_list<TN>>& ilist,
             seoncore::enums::Major major = seoncore::enums::Major::Row) noexcept
-        : _major(major)
+        : _data(ilist.size() == 0 ? 0 : ilist.size() * ilist.begin()->size())
+        , _major(major)
     {
         _rows = ilist.size();
+        _cols = (_rows == 0) ? 0 : ilist.begin()->size();
 
-        for (auto& row : ilist)
-        {
-            _cols = row.size();
-            break;
-        };
-
+        pointer out = _data.data();
         for (auto& row : ilist)
         {
             assert(_cols == row.size());
 
             for (auto& elem : row)
-                _data.push_back(elem);
+                *out++ = elem;
         };
 
         _init_strides();
+        _count_alloc();
     };
 
 
 private:
-    std::vector<TN>         _data;
-    size_type               _rows;
-    size_type               _cols;
-    size_type               _sr;
-    size_type               _sc;
-    seoncore::enums::Major  _major;
+    Storage                 _data;
+    size_type               _rows = 0;
+    size_type               _cols = 0;
+    size_type               _sr = 0;
+    size_type               _sc = 0;
+    seoncore::enums::Major  _major = seoncore::enums::Major::Row;
 
     constexpr void _init_strides() noexcept
     {
@@ -216,6 +237,26 @@ private:
         _init_strides();
     };
 
+    // Instrumentation only: one element buffer was materialized.
+    constexpr void _count_alloc() const noexcept
+    {
+        if (_rows * _cols != 0)
+            SEONCORE_COUNT_ALLOC(_rows * _cols * sizeof(TN));
+    };
+
+    // Instrumentation only: bytes read and written by copying the buffer,
+    // none when the storage shares it instead.
+    constexpr double _copy_bytes() const noexcept
+    {
+        if constexpr (seoncore::concepts::CopyOnWriteStorage<Storage>) return 0.0;
+        else return 2.0 * _rows * _cols * sizeof(TN);
+    };
+
+    constexpr void _count_copy() const noexcept
+    {
+        if constexpr (!seoncore::concepts::CopyOnWriteStorage<Storage>) _count_alloc();
+    };
+
     constexpr void _null_st_params(DenseMatrix& a) noexcept
     {
         a._rows = 0;
@@ -272,7 +313,7 @@ private:
     constexpr seoncore::views::TransposedView<self>
     transposed_impl() const noexcept { return seoncore::views::TransposedView<self>(*this); };
 
-}; // class DenseMatrix<TN>
+}; // class DenseMatrix<TN, Storage>
 
 }; // namespace seoncore::matrix
 
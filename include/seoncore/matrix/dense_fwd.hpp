@@ -1,7 +1,9 @@
 #pragma once
 
+#include <vector>
+
 namespace seoncore::matrix
 {
-template <typename TN>
+template <typename TN, class Storage = std::vector<TN>>
 class DenseMatrix;
 };
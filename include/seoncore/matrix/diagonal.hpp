@@ -0,0 +1,80 @@
+#pragma once
+
+#include <initializer_list>
+#include <vector>
+#include <seoncore/matrix/base.hpp>
+#include <seoncore/matrix/structured_ref.hpp>
+#include <seoncore/views/vec.hpp>
+
+namespace seoncore::matrix
+{
+
+// Square n x n matrix that stores only its diagonal. Off-diagonal entries
+// read as zero; writing anything but zero to them is rejected (see
+// StructuredRef).
+template <typename TN>
+class DiagonalMatrix : public BaseMatrix<DiagonalMatrix<TN>, TN>
+{
+public:
+    friend struct BaseMatrix<DiagonalMatrix<TN>, TN>;
+
+    using self                  = DiagonalMatrix<TN>;
+    using size_type             = std::size_t;
+    using value_type            = TN;
+    using type                  = TN;
+    using reference             = StructuredRef<TN>;
+    using const_ref             = const TN&;
+    using pointer               = TN*;
+    using const_ptr             = const TN*;
+    using vec_view              = seoncore::views::VectorView<TN>;
+    using mut_vec_view          = seoncore::views::MutableVectorView<TN>;
+
+    constexpr DiagonalMatrix() noexcept = default;
+
+    constexpr explicit DiagonalMatrix(size_type n)
+        : _diag(n)
+    {};
+
+    constexpr explicit DiagonalMatrix(const std::vector<TN>& diag)
+        : _diag(diag)
+    {};
+
+    constexpr DiagonalMatrix(const std::initializer_list<TN>& diag)
+        : _diag(diag)
+    {};
+
+    constexpr bool operator==(const DiagonalMatrix& other) const noexcept { return _diag == other._diag; };
+    constexpr bool operator!=(const DiagonalMatrix& other) const noexcept { return !(*this == other); };
+
+    constexpr mut_vec_view diagonal() noexcept { return mut_vec_view(_diag.data(), _diag.size(), 1); };
+    constexpr vec_view diagonal() const noexcept { return vec_view(_diag.data(), _diag.size(), 1); };
+
+private:
+    static constexpr TN _zero{};
+
+    std::vector<TN>     _diag;
+
+    constexpr size_type rows_impl() const noexcept { return _diag.size(); };
+    constexpr size_type cols_impl() const noexcept { return _diag.size(); };
+
+    constexpr pointer data_impl() { return _diag.data(); };
+    constexpr const_ptr data_impl() const { return _diag.data(); };
+
+    constexpr reference at_impl(size_type i, size_type j) noexcept
+    {
+        return reference(i == j ? &_diag[i] : nullptr);
+    };
+
+    constexpr const_ref at_impl(size_type i, size_type j) const noexcept
+    {
+        return (i == j) ? _diag[i] : _zero;
+    };
+
+    constexpr self& transposed_impl() noexcept { return *this; };
+    constexpr const self& transposed_impl() const noexcept { return *this; };
+
+}; // class DiagonalMatrix<TN>
+
+}; // namespace seoncore::matrix
+
+#include <seoncore/ops/structured_ops.hpp>
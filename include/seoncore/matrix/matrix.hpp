@@ -1,4 +1,13 @@
 #pragma once
 #include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/shared.hpp>
+#include <seoncore/matrix/small.hpp>
+#include <seoncore/matrix/quantized.hpp>
+#include <seoncore/matrix/diagonal.hpp>
+#include <seoncore/matrix/banded.hpp>
+#include <seoncore/matrix/triangular.hpp>
+#include <seoncore/matrix/symmetric.hpp>
 #include <seoncore/matrix/seonarr.hpp>
+#include <seoncore/matrix/numa.hpp>
+#include <seoncore/matrix/product_chain.hpp>
 #include <seoncore/matrix/operators.hpp>
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/storage/numa.hpp>
+
+namespace seoncore::matrix
+{
+
+// DenseMatrix whose buffer is initialized node-locally, in the same row
+// partition GEMM uses for its output (see storage::NumaStorage).
+template <typename TN, seoncore::storage::NumaPlacement P = seoncore::storage::NumaPlacement::FirstTouch>
+using NumaDenseMatrix = DenseMatrix<TN, seoncore::storage::NumaStorage<TN, P>>;
+
+}; // namespace seoncore::matrix
@@ -1,17 +1,34 @@
 #pragma once
 
+#include <concepts>
+#include <type_traits>
+#include <utility>
 #include <seoncore/ops/matmul.hpp>
 #include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/matrix/product_chain.hpp>
 
 namespace seoncore::matrix
 {
 
 template <class A, class B>
-requires seoncore::concepts::MatrixLike<A> && seoncore::concepts::MatrixLike<B>
+concept _chain_pair =
+    ChainOperand<std::remove_cvref_t<A>> && ChainOperand<std::remove_cvref_t<B>> &&
+    std::same_as<typename std::remove_cvref_t<A>::value_type, typename std::remove_cvref_t<B>::value_type>;
+
+template <class A, class B>
+requires seoncore::concepts::MatrixLike<A> && seoncore::concepts::MatrixLike<B> && (!_chain_pair<A, B>)
 constexpr auto operator*(const A& a, const B& b)
 {
     return seoncore::ops::matmul(a, b);
 }
 
-} // namespace seoncore::matrix
+// Products of dense operands (and of chains) are collected into a
+// ProductChain, which plans the multiply order when it is first read.
+template <class A, class B>
+requires _chain_pair<A, B>
+auto operator*(A&& a, B&& b)
+{
+    return ProductChain<typename std::remove_cvref_t<A>::value_type>(std::forward<A>(a), std::forward<B>(b));
+}
 
+} // namespace seoncore::matrix
@@ -0,0 +1,330 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/strided.hpp>
+#include <seoncore/ops/gemm.hpp>
+
+namespace seoncore::matrix
+{
+
+// Dense matrices of arithmetic type and (nested) transposed views of them:
+// the operands a ProductChain can hold.
+template <class M>
+concept ChainOperand = StridedDense<M> && std::is_arithmetic_v<typename M::value_type>;
+
+template <typename TN>
+class ProductChain;
+
+// A single factor for a ProductChain<TN>, as opposed to another chain.
+template <class M, typename TN>
+concept _chain_factor =
+    ChainOperand<std::remove_cvref_t<M>> &&
+    std::same_as<typename std::remove_cvref_t<M>::value_type, TN> &&
+    !std::same_as<std::remove_cvref_t<M>, ProductChain<TN>>;
+
+// Product F0 * F1 * ... * Fn-1 of ChainOperands, built by operator* and
+// evaluated on first use. Evaluation picks the cheapest parenthesization
+// for the actual shapes by the classic matrix-chain dynamic program, so
+// A * B * C * v costs three matrix-vector products rather than two
+// matrix-matrix ones, then runs it with the GEMM kernel, recycling
+// intermediate buffers between steps.
+//
+// A chain is MatrixLike (and StridedDense): rows(), cols() and element
+// access read a result evaluated once, on first access, and shared by
+// copies of the chain, so ops::abs(A * B) and `auto P = A * B;` work and
+// hand P to the GEMM kernel directly. eval() and conversion to DenseMatrix
+// produce a fresh matrix instead.
+//
+// The chain refers to its lvalue operands, like a view, and must not
+// outlive them; temporaries (`A * (B + C)`) are moved into the chain. The
+// cached result reflects the operands as they were when first read.
+template <typename TN>
+class ProductChain
+{
+public:
+    using value_type    = TN;
+    using size_type     = std::size_t;
+    using const_ref     = const TN&;
+    using factor_type   = StridedLayout<TN>;
+
+    ProductChain() = default;
+
+    template <class A, class B>
+    ProductChain(A&& a, B&& b)
+    {
+        append(std::forward<A>(a));
+        append(std::forward<B>(b));
+    };
+
+    template <class M>
+    requires _chain_factor<M, TN>
+    ProductChain& append(M&& m)
+    {
+        const factor_type f = _strided_layout(_hold(std::forward<M>(m)));
+        assert(_factors.empty() || _factors.back().cols == f.rows);
+        _factors.push_back(f);
+        _cache = std::make_shared<_cache_t>();
+        return *this;
+    };
+
+    template <class M>
+    requires _chain_factor<M, TN>
+    ProductChain& prepend(M&& m)
+    {
+        const factor_type f = _strided_layout(_hold(std::forward<M>(m)));
+        assert(_factors.empty() || f.cols == _factors.front().rows);
+        _factors.insert(_factors.begin(), f);
+        _cache = std::make_shared<_cache_t>();
+        return *this;
+    };
+
+    ProductChain& append(const ProductChain& other)
+    {
+        assert(_factors.empty() || other._factors.empty() || _factors.back().cols == other._factors.front().rows);
+        _factors.insert(_factors.end(), other._factors.begin(), other._factors.end());
+        _owned.insert(_owned.end(), other._owned.begin(), other._owned.end());
+        _cache = std::make_shared<_cache_t>();
+        return *this;
+    };
+
+    ProductChain& prepend(const ProductChain& other)
+    {
+        assert(_factors.empty() || other._factors.empty() || other._factors.back().cols == _factors.front().rows);
+        _factors.insert(_factors.begin(), other._factors.begin(), other._factors.end());
+        _owned.insert(_owned.end(), other._owned.begin(), other._owned.end());
+        _cache = std::make_shared<_cache_t>();
+        return *this;
+    };
+
+    size_type rows() const noexcept { return _factors.empty() ? 0 : _factors.front().rows; };
+    size_type cols() const noexcept { return _factors.empty() ? 0 : _factors.back().cols; };
+    size_type length() const noexcept { return _factors.size(); };
+
+    const std::vector<factor_type>& factors() const noexcept { return _factors; };
+
+    // Multiply-adds of the chosen order, and of plain left-to-right order.
+    double cost() const { return _plan().cost; };
+    double left_to_right_cost() const noexcept
+    {
+        double c = 0;
+        for (size_type i = 1; i < _factors.size(); ++i)
+            c += double(rows()) * double(_factors[i].rows) * double(_factors[i].cols);
+        return c;
+    };
+
+    template <class Storage = std::vector<TN>>
+    DenseMatrix<TN, Storage> eval() const
+    {
+        assert(!_factors.empty());
+
+        DenseMatrix<TN, Storage> out(rows(), cols());
+        if (_factors.size() == 1)
+        {
+            const factor_type& f = _factors.front();
+            for (size_type i = 0; i < f.rows; ++i)
+                for (size_type j = 0; j < f.cols; ++j)
+                    out(i, j) = f.data[static_cast<std::ptrdiff_t>(i) * f.rs + static_cast<std::ptrdiff_t>(j) * f.cs];
+            return out;
+        };
+
+        const _plan_t plan = _plan();
+        SEONCORE_OP_SCOPE("matmul_chain", seoncore::enums::Path::Direct, rows(), cols(), _factors.size(),
+                          2.0 * plan.cost, static_cast<double>(rows() * cols()) * sizeof(TN));
+
+        _buffers buffers;
+        _run(plan, 0, _factors.size() - 1, buffers, out.data());
+        return out;
+    };
+
+    template <class Storage>
+    operator DenseMatrix<TN, Storage>() const { return eval<Storage>(); };
+
+    // The product, evaluated on the first call and cached. Safe to call
+    // from several threads at once.
+    const DenseMatrix<TN>& value() const
+    {
+        _cache_t& cache = *_cache;
+        std::call_once(cache.once, [&] { cache.value = eval(); });
+        return cache.value;
+    };
+
+    const_ref at(size_type i, size_type j) const { return value()(i, j); };
+    const_ref operator()(size_type i, size_type j) const { return value()(i, j); };
+
+private:
+    struct _cache_t
+    {
+        std::once_flag      once;
+        DenseMatrix<TN>     value;
+    };
+
+    std::vector<factor_type>            _factors;
+    std::vector<std::shared_ptr<void>>  _owned;     // temporaries moved in
+    std::shared_ptr<_cache_t>           _cache = std::make_shared<_cache_t>();
+
+    // A stable reference to m: lvalues and views are used in place, a
+    // temporary matrix is moved into the chain first.
+    template <class M>
+    const std::remove_cvref_t<M>& _hold(M&& m)
+    {
+        using T = std::remove_cvref_t<M>;
+        if constexpr (std::is_rvalue_reference_v<M&&> && !is_transposed_view_v<T>)
+        {
+            auto owned = std::make_shared<T>(std::forward<M>(m));
+            _owned.push_back(owned);
+            return *owned;
+        }
+        else
+            return m;
+    };
+
+    struct _plan_t
+    {
+        size_type               n;
+        std::vector<size_type>  split;      // split[i * n + j]: last factor of the left part
+        double                  cost;
+    };
+
+    // cost[i][j] = min over i <= s < j of cost[i][s] + cost[s+1][j]
+    //              + rows_i * cols_s * cols_j
+    _plan_t _plan() const
+    {
+        const size_type n = _factors.size();
+        std::vector<double> cost(n * n, 0.0);
+        _plan_t plan{ n, std::vector<size_type>(n * n, 0), 0.0 };
+
+        for (size_type len = 2; len <= n; ++len)
+        {
+            for (size_type i = 0; i + len <= n; ++i)
+            {
+                const size_type j = i + len - 1;
+                double best = std::numeric_limits<double>::infinity();
+
+                for (size_type s = i; s < j; ++s)
+                {
+                    const double c = cost[i * n + s] + cost[(s + 1) * n + j]
+                                   + double(_factors[i].rows) * double(_factors[s].cols) * double(_factors[j].cols);
+                    if (c < best)
+                    {
+                        best = c;
+                        plan.split[i * n + j] = s;
+                    };
+                };
+                cost[i * n + j] = best;
+            };
+        };
+
+        plan.cost = cost[n - 1];
+        return plan;
+    };
+
+    // Row-major scratch for intermediates. A product takes the smallest
+    // free buffer that fits (growing the largest one otherwise) and hands
+    // its operands' buffers back once it is done with them, so a chain of
+    // any length needs only a few allocations.
+    struct _buffers
+    {
+        std::vector<std::vector<TN>>    pool;
+        std::vector<bool>               busy;
+
+        size_type acquire(size_type n)
+        {
+            size_type pick = pool.size();
+            for (size_type b = 0; b < pool.size(); ++b)
+            {
+                if (busy[b]) continue;
+                if (pick == pool.size()) { pick = b; continue; };
+
+                const bool fits = pool[b].size() >= n;
+                const bool pick_fits = pool[pick].size() >= n;
+                if ((fits && (!pick_fits || pool[b].size() < pool[pick].size())) ||
+                    (!fits && !pick_fits && pool[b].size() > pool[pick].size()))
+                    pick = b;
+            };
+
+            if (pick == pool.size())
+            {
+                pool.emplace_back();
+                busy.push_back(false);
+            };
+            if (pool[pick].size() < n) pool[pick].resize(n);
+            busy[pick] = true;
+            return pick;
+        };
+
+        void release(size_type b) noexcept { busy[b] = false; };
+    };
+
+    static constexpr size_type _none = std::numeric_limits<size_type>::max();
+
+    // Evaluates factors i..j into dst when given, else into a scratch
+    // buffer; returns the result's layout and its buffer (or _none).
+    std::pair<factor_type, size_type> _run(const _plan_t& plan, size_type i, size_type j, _buffers& buffers, TN* dst) const
+    {
+        if (i == j) return { _factors[i], _none };
+
+        const size_type s = plan.split[i * plan.n + j];
+        const auto [a, abuf] = _run(plan, i, s, buffers, nullptr);
+        const auto [b, bbuf] = _run(plan, s + 1, j, buffers, nullptr);
+
+        const size_type m = a.rows;
+        const size_type n = b.cols;
+
+        size_type cbuf = _none;
+        if (dst == nullptr)
+        {
+            cbuf = buffers.acquire(m * n);
+            dst = buffers.pool[cbuf].data();
+        };
+
+        seoncore::ops::gemm<TN>(m, n, a.cols,
+                                TN{1}, a.data, a.rs, a.cs, b.data, b.rs, b.cs,
+                                TN{0}, dst, static_cast<std::ptrdiff_t>(n), 1);
+
+        if (abuf != _none) buffers.release(abuf);
+        if (bbuf != _none) buffers.release(bbuf);
+
+        return { factor_type{ dst, m, n, static_cast<std::ptrdiff_t>(n), 1 }, cbuf };
+    };
+
+}; // class ProductChain<TN>
+
+// The evaluated product as GEMM reads it, so a chain can feed the kernel.
+template <typename TN>
+StridedLayout<TN> _strided_layout(const ProductChain<TN>& chain)
+{
+    return _strided_layout(chain.value());
+};
+
+}; // namespace seoncore::matrix
+
+
+namespace seoncore::ops
+{
+
+// A0 * A1 * ... * An-1 in the cheapest order for the operands' shapes,
+// evaluated into a new matrix; what `DenseMatrix R = A0 * A1 * ...` does.
+template <seoncore::matrix::ChainOperand A, seoncore::matrix::ChainOperand... Rest>
+requires (std::same_as<typename A::value_type, typename Rest::value_type> && ...)
+seoncore::matrix::DenseMatrix<typename A::value_type> multi_dot(const A& a, const Rest&... rest)
+{
+    seoncore::matrix::ProductChain<typename A::value_type> chain;
+    chain.append(a);
+    (chain.append(rest), ...);
+    return chain.eval();
+};
+
+}; // namespace seoncore::ops
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <seoncore/enums/axis.hpp>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/base.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/concepts/matrix_like.hpp>
+
+namespace seoncore::matrix
+{
+
+// int8 codes with one affine (scale, zero point) pair per row or per column:
+//   x ~= scale * (q - zero_point),  q in [-127, 127]
+// Codes are stored so the quantization axis is contiguous: row-quantized
+// matrices are row-major, column-quantized ones column-major. That is the
+// layout the int8 GEMM wants for its left and right operands respectively.
+class QuantizedMatrix : public BaseMatrix<QuantizedMatrix, std::int8_t>
+{
+public:
+    friend struct BaseMatrix<QuantizedMatrix, std::int8_t>;
+
+    using self                  = QuantizedMatrix;
+    using size_type             = std::size_t;
+    using value_type            = std::int8_t;
+    using type                  = std::int8_t;
+    using reference             = std::int8_t&;
+    using const_ref             = const std::int8_t&;
+    using pointer               = std::int8_t*;
+    using const_ptr             = const std::int8_t*;
+    using vec_view              = seoncore::views::VectorView<std::int8_t>;
+    using mut_vec_view          = seoncore::views::MutableVectorView<std::int8_t>;
+
+    static constexpr std::int32_t qmin = -127;
+    static constexpr std::int32_t qmax =  127;
+
+    QuantizedMatrix() noexcept = default;
+
+    QuantizedMatrix(
+            size_type rows,
+            size_type cols,
+            seoncore::enums::Axis axis = seoncore::enums::Axis::Row)
+        : _data(rows * cols)
+        , _scales(axis == seoncore::enums::Axis::Row ? rows : cols, 1.0f)
+        , _zero_points(_scales.size(), 0)
+        , _sums(_scales.size(), 0)
+        , _rows(rows)
+        , _cols(cols)
+        , _axis(axis)
+    {
+        _major = (axis == seoncore::enums::Axis::Row)
+            ? seoncore::enums::Major::Row
+            : seoncore::enums::Major::Column;
+        _init_strides();
+    };
+
+    QuantizedMatrix(
+            std::vector<std::int8_t> codes,
+            std::vector<float> scales,
+            std::vector<std::int32_t> zero_points,
+            std::vector<std::int64_t> sums,
+            size_type rows,
+            size_type cols,
+            seoncore::enums::Axis axis = seoncore::enums::Axis::Row)
+        : _data(std::move(codes))
+        , _scales(std::move(scales))
+        , _zero_points(std::move(zero_points))
+        , _sums(std::move(sums))
+        , _rows(rows)
+        , _cols(cols)
+        , _axis(axis)
+    {
+        assert(_data.size() == rows * cols);
+        assert(_scales.size() == (axis == seoncore::enums::Axis::Row ? rows : cols));
+        assert(_zero_points.size() == _scales.size());
+        assert(_sums.size() == _scales.size());
+        // -128 is the one int8 code outside [qmin, qmax]; it would saturate
+        // the u8 * s8 pair sums of the int8 kernels (see ops/qgemm.hpp).
+        assert(std::all_of(_data.begin(), _data.end(), [](std::int8_t q) { return q >= qmin; }));
+        assert(std::all_of(_zero_points.begin(), _zero_points.end(), [](std::int32_t z) { return z >= qmin && z <= qmax; }));
+
+        _major = (axis == seoncore::enums::Axis::Row)
+            ? seoncore::enums::Major::Row
+            : seoncore::enums::Major::Column;
+        _init_strides();
+    };
+
+    constexpr seoncore::enums::Axis axis() const noexcept { return _axis; };
+
+    // Number of (scale, zero point) slices and the length of each slice.
+    constexpr size_type slices() const noexcept { return _scales.size(); };
+    constexpr size_type slice_len() const noexcept
+    {
+        return _axis == seoncore::enums::Axis::Row ? _cols : _rows;
+    };
+
+    const std::int8_t* slice(size_type s) const noexcept { return _data.data() + s * slice_len(); };
+
+    const std::vector<float>&        scales() const noexcept { return _scales; };
+    const std::vector<std::int32_t>& zero_points() const noexcept { return _zero_points; };
+    const std::vector<std::int64_t>& sums() const noexcept { return _sums; };
+
+    float dequantized(size_type i, size_type j) const noexcept
+    {
+        const size_type s = (_axis == seoncore::enums::Axis::Row) ? i : j;
+        return _scales[s] * static_cast<float>(static_cast<std::int32_t>(at_impl(i, j)) - _zero_points[s]);
+    };
+
+    seoncore::matrix::DenseMatrix<float> dequantize() const
+    {
+        seoncore::matrix::DenseMatrix<float> out(_rows, _cols);
+
+        for (size_type i = 0; i < _rows; ++i)
+            for (size_type j = 0; j < _cols; ++j)
+                out(i, j) = dequantized(i, j);
+
+        return out;
+    };
+
+private:
+    std::vector<std::int8_t>    _data;
+    std::vector<float>          _scales;
+    std::vector<std::int32_t>   _zero_points;
+    std::vector<std::int64_t>   _sums;
+    size_type                   _rows = 0;
+    size_type                   _cols = 0;
+    size_type                   _sr = 0;
+    size_type                   _sc = 0;
+    seoncore::enums::Major      _major = seoncore::enums::Major::Row;
+    seoncore::enums::Axis       _axis = seoncore::enums::Axis::Row;
+
+    constexpr void _init_strides() noexcept
+    {
+        if (_major == seoncore::enums::Major::Row)
+        {
+            _sr = _cols;
+            _sc = 1;
+        }
+        else
+        {
+            _sr = 1;
+            _sc = _rows;
+        };
+    };
+
+    constexpr size_type rows_impl() const noexcept { return _rows; };
+    constexpr size_type cols_impl() const noexcept { return _cols; };
+
+    pointer data_impl() { return _data.data(); };
+    const_ptr data_impl() const { return _data.data(); };
+
+    // Layout follows the quantization axis, so the major is read-only.
+    constexpr const seoncore::enums::Major& major_impl() const { return _major; };
+
+    reference at_impl(size_type i, size_type j) noexcept { return _data[i * _sr + j * _sc]; };
+    const_ref at_impl(size_type i, size_type j) const noexcept { return _data[i * _sr + j * _sc]; };
+
+    mut_vec_view row_impl(size_type i) noexcept { return mut_vec_view(_data.data() + i * _sr, _cols, _sc); };
+    vec_view row_impl(size_type i) const noexcept { return vec_view(_data.data() + i * _sr, _cols, _sc); };
+
+    mut_vec_view col_impl(size_type j) noexcept { return mut_vec_view(_data.data() + j * _sc, _rows, _sr); };
+    vec_view col_impl(size_type j) const noexcept { return vec_view(_data.data() + j * _sc, _rows, _sr); };
+
+    mut_vec_view flatten_impl() noexcept { return mut_vec_view(_data.data(), _rows * _cols, 1); };
+    vec_view flatten_impl() const noexcept { return vec_view(_data.data(), _rows * _cols, 1); };
+
+}; // class QuantizedMatrix
+
+// Affine int8 quantization of any matrix with one (scale, zero point) per
+// row (`Axis::Row`) or per column (`Axis::Column`). The representable range
+// always contains zero so that exact zeros survive the round trip.
+template <seoncore::concepts::MatrixLike A>
+QuantizedMatrix quantize(const A& a, seoncore::enums::Axis axis = seoncore::enums::Axis::Row)
+{
+    const bool by_row = (axis == seoncore::enums::Axis::Row);
+    const std::size_t n_slices = by_row ? a.rows() : a.cols();
+    const std::size_t len = by_row ? a.cols() : a.rows();
+
+    std::vector<std::int8_t>  codes(n_slices * len);
+    std::vector<float>        scales(n_slices);
+    std::vector<std::int32_t> zero_points(n_slices);
+    std::vector<std::int64_t> sums(n_slices);
+
+    auto elem = [&](std::size_t s, std::size_t p) -> float
+    {
+        return static_cast<float>(by_row ? a(s, p) : a(p, s));
+    };
+
+    for (std::size_t s = 0; s < n_slices; ++s)
+    {
+        float lo = 0.0f;
+        float hi = 0.0f;
+        for (std::size_t p = 0; p < len; ++p)
+        {
+            lo = std::min(lo, elem(s, p));
+            hi = std::max(hi, elem(s, p));
+        };
+
+        const float range = static_cast<float>(QuantizedMatrix::qmax - QuantizedMatrix::qmin);
+        const float scale = (hi > lo) ? (hi - lo) / range : 1.0f;
+        const std::int32_t zp = std::clamp(
+            static_cast<std::int32_t>(std::lround(static_cast<float>(QuantizedMatrix::qmin) - lo / scale)),
+            QuantizedMatrix::qmin,
+            QuantizedMatrix::qmax);
+
+        std::int8_t* out = codes.data() + s * len;
+        std::int64_t total = 0;
+        for (std::size_t p = 0; p < len; ++p)
+        {
+            const std::int32_t v = std::clamp(
+                static_cast<std::int32_t>(std::lround(elem(s, p) / scale)) + zp,
+                QuantizedMatrix::qmin,
+                QuantizedMatrix::qmax);
+            out[p] = static_cast<std::int8_t>(v);
+            total += v;
+        };
+
+        scales[s]      = scale;
+        zero_points[s] = zp;
+        sums[s]        = total;
+    };
+
+    return QuantizedMatrix(
+        std::move(codes), std::move(scales), std::move(zero_points), std::move(sums),
+        a.rows(), a.cols(), axis);
+};
+
+}; // namespace seoncore::matrix
+
+#include <seoncore/ops/quantized_ops.hpp>
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/storage/shared.hpp>
+
+namespace seoncore::matrix
+{
+
+// DenseMatrix whose copies share storage until one of them is written to.
+template <typename TN>
+using SharedDenseMatrix = DenseMatrix<TN, seoncore::storage::SharedStorage<TN>>;
+
+}; // namespace seoncore::matrix
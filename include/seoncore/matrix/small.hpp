@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/storage/small.hpp>
+
+namespace seoncore::matrix
+{
+
+// DenseMatrix that keeps up to `N` elements inline and only allocates above.
+template <typename TN, std::size_t N = 64>
+using SmallDenseMatrix = DenseMatrix<TN, seoncore::storage::SmallStorage<TN, N>>;
+
+}; // namespace seoncore::matrix
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/dense_fwd.hpp>
+#include <seoncore/views/transposed.hpp>
+
+namespace seoncore::matrix
+{
+
+// Storage of a dense operand as the GEMM kernel reads it: element (i, j)
+// at data[i * rs + j * cs]. A transposed view is its base with rows/cols
+// and the strides swapped, so a view, however deeply nested, resolves to
+// the storage of the matrix underneath.
+template <typename TN>
+struct StridedLayout
+{
+    const TN*       data;
+    std::size_t     rows;
+    std::size_t     cols;
+    std::ptrdiff_t  rs;
+    std::ptrdiff_t  cs;
+
+    constexpr StridedLayout transposed() const noexcept { return { data, cols, rows, cs, rs }; };
+};
+
+template <typename TN, class S>
+constexpr StridedLayout<TN> _strided_layout(const DenseMatrix<TN, S>& M) noexcept
+{
+    if (M.major() == seoncore::enums::Major::Row)
+        return { M.data(), M.rows(), M.cols(), static_cast<std::ptrdiff_t>(M.cols()), 1 };
+    return { M.data(), M.rows(), M.cols(), 1, static_cast<std::ptrdiff_t>(M.rows()) };
+};
+
+template <class B, bool C>
+constexpr auto _strided_layout(const seoncore::views::BaseTransposedView<B, C>& V) noexcept
+    -> decltype(_strided_layout(V.base()))
+{
+    return _strided_layout(V.base()).transposed();
+};
+
+template <class M>
+inline constexpr bool is_transposed_view_v = false;
+
+template <class B, bool C>
+inline constexpr bool is_transposed_view_v<seoncore::views::BaseTransposedView<B, C>> = true;
+
+// DenseMatrix and (nested) transposed views of one.
+template <class M>
+concept StridedDense =
+    seoncore::concepts::MatrixLike<M> &&
+    requires(const M& m)
+    {
+        { _strided_layout(m) } -> std::same_as<StridedLayout<typename M::value_type>>;
+    };
+
+}; // namespace seoncore::matrix
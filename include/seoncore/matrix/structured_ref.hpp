@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cassert>
+
+namespace seoncore::matrix
+{
+
+// Writable element of a structured matrix (diagonal, banded, triangular):
+// the stored slot, or none for an entry outside the structure. Such an
+// entry reads as zero and can only be assigned zero; any other write is
+// rejected, since there is nowhere to keep it.
+template <typename TN>
+class StructuredRef
+{
+public:
+    constexpr explicit StructuredRef(TN* slot) noexcept
+        : _slot(slot)
+    {};
+
+    constexpr StructuredRef(const StructuredRef&) noexcept = default;
+
+    constexpr operator TN() const noexcept { return _slot ? *_slot : TN{}; };
+
+    // Whether the entry is stored, i.e. may take nonzero values.
+    constexpr bool stored() const noexcept { return _slot != nullptr; };
+
+    constexpr StructuredRef& operator=(const TN& v) noexcept
+    {
+        assert(_slot != nullptr || v == TN{});
+        if (_slot) *_slot = v;
+        return *this;
+    };
+
+    // Assigns the value, not the binding, like a TN&.
+    constexpr StructuredRef& operator=(const StructuredRef& other) noexcept { return *this = TN(other); };
+
+    constexpr StructuredRef& operator+=(const TN& v) noexcept { return *this = TN(*this) + v; };
+    constexpr StructuredRef& operator-=(const TN& v) noexcept { return *this = TN(*this) - v; };
+    constexpr StructuredRef& operator*=(const TN& v) noexcept { return *this = TN(*this) * v; };
+    constexpr StructuredRef& operator/=(const TN& v) noexcept { return *this = TN(*this) / v; };
+
+private:
+    TN* _slot;
+
+}; // class StructuredRef<TN>
+
+}; // namespace seoncore::matrix
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cassert>
+#include <utility>
+#include <vector>
+#include <seoncore/matrix/base.hpp>
+#include <seoncore/views/vec.hpp>
+
+namespace seoncore::matrix
+{
+
+// Square n x n symmetric matrix holding only its lower triangle, packed
+// row-major. (i, j) and (j, i) name the same element, so writing one
+// writes both.
+template <typename TN>
+class SymmetricMatrix : public BaseMatrix<SymmetricMatrix<TN>, TN>
+{
+public:
+    friend struct BaseMatrix<SymmetricMatrix<TN>, TN>;
+
+    using self                  = SymmetricMatrix<TN>;
+    using size_type             = std::size_t;
+    using value_type            = TN;
+    using type                  = TN;
+    using reference             = TN&;
+    using const_ref             = const TN&;
+    using pointer               = TN*;
+    using const_ptr             = const TN*;
+    using vec_view              = seoncore::views::VectorView<TN>;
+    using mut_vec_view          = seoncore::views::MutableVectorView<TN>;
+
+    constexpr SymmetricMatrix() noexcept = default;
+
+    constexpr explicit SymmetricMatrix(size_type n)
+        : _packed(n * (n + 1) / 2)
+        , _n(n)
+    {};
+
+    constexpr bool operator==(const SymmetricMatrix& other) const noexcept
+    {
+        return _packed == other._packed && _n == other._n;
+    };
+
+    constexpr bool operator!=(const SymmetricMatrix& other) const noexcept { return !(*this == other); };
+
+    // Lower-triangle entries of row i, columns 0 .. i.
+    constexpr const_ptr row_packed(size_type i) const noexcept
+    {
+        return _packed.data() + i * (i + 1) / 2;
+    };
+
+private:
+    std::vector<TN>     _packed;
+    size_type           _n = 0;
+
+    static constexpr size_type _index(size_type i, size_type j) noexcept
+    {
+        if (i < j) std::swap(i, j);
+        return i * (i + 1) / 2 + j;
+    };
+
+    constexpr size_type rows_impl() const noexcept { return _n; };
+    constexpr size_type cols_impl() const noexcept { return _n; };
+
+    constexpr pointer data_impl() { return _packed.data(); };
+    constexpr const_ptr data_impl() const { return _packed.data(); };
+
+    constexpr reference at_impl(size_type i, size_type j) noexcept { return _packed[_index(i, j)]; };
+    constexpr const_ref at_impl(size_type i, size_type j) const noexcept { return _packed[_index(i, j)]; };
+
+    constexpr self& transposed_impl() noexcept { return *this; };
+    constexpr const self& transposed_impl() const noexcept { return *this; };
+
+}; // class SymmetricMatrix<TN>
+
+}; // namespace seoncore::matrix
+
+#include <seoncore/ops/structured_ops.hpp>
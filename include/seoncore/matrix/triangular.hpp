@@ -0,0 +1,116 @@
+#pragma once
+
+#include <vector>
+#include <seoncore/enums/triangle.hpp>
+#include <seoncore/matrix/base.hpp>
+#include <seoncore/matrix/structured_ref.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/views/transposed.hpp>
+
+namespace seoncore::matrix
+{
+
+// Square n x n triangular matrix in packed row-major storage: n(n+1)/2
+// elements, with the stored part of each row contiguous. Entries outside
+// the triangle read as zero; writing anything but zero to them is
+// rejected (see StructuredRef).
+template <typename TN>
+class TriangularMatrix : public BaseMatrix<TriangularMatrix<TN>, TN>
+{
+public:
+    friend struct BaseMatrix<TriangularMatrix<TN>, TN>;
+
+    using self                  = TriangularMatrix<TN>;
+    using size_type             = std::size_t;
+    using value_type            = TN;
+    using type                  = TN;
+    using reference             = StructuredRef<TN>;
+    using const_ref             = const TN&;
+    using pointer               = TN*;
+    using const_ptr             = const TN*;
+    using vec_view              = seoncore::views::VectorView<TN>;
+    using mut_vec_view          = seoncore::views::MutableVectorView<TN>;
+
+    constexpr TriangularMatrix() noexcept = default;
+
+    constexpr TriangularMatrix(
+            size_type n,
+            seoncore::enums::Triangle uplo = seoncore::enums::Triangle::Lower)
+        : _packed(n * (n + 1) / 2)
+        , _n(n)
+        , _uplo(uplo)
+    {};
+
+    constexpr bool operator==(const TriangularMatrix& other) const noexcept
+    {
+        return _packed == other._packed && _n == other._n && _uplo == other._uplo;
+    };
+
+    constexpr bool operator!=(const TriangularMatrix& other) const noexcept { return !(*this == other); };
+
+    constexpr seoncore::enums::Triangle uplo() const noexcept { return _uplo; };
+
+    constexpr bool in_triangle(size_type i, size_type j) const noexcept
+    {
+        return (_uplo == seoncore::enums::Triangle::Lower) ? j <= i : i <= j;
+    };
+
+    // Columns [first, last) stored for row i.
+    constexpr size_type row_first(size_type i) const noexcept
+    {
+        return (_uplo == seoncore::enums::Triangle::Lower) ? 0 : i;
+    };
+
+    constexpr size_type row_last(size_type i) const noexcept
+    {
+        return (_uplo == seoncore::enums::Triangle::Lower) ? i + 1 : _n;
+    };
+
+    // Stored entries of row i, starting at column row_first(i).
+    constexpr const_ptr row_packed(size_type i) const noexcept
+    {
+        return _packed.data() + _index(i, row_first(i));
+    };
+
+private:
+    static constexpr TN _zero{};
+
+    std::vector<TN>             _packed;
+    size_type                   _n = 0;
+    seoncore::enums::Triangle   _uplo = seoncore::enums::Triangle::Lower;
+
+    constexpr size_type _index(size_type i, size_type j) const noexcept
+    {
+        if (_uplo == seoncore::enums::Triangle::Lower)
+            return i * (i + 1) / 2 + j;
+
+        return i * _n - i * (i - 1) / 2 + (j - i);
+    };
+
+    constexpr size_type rows_impl() const noexcept { return _n; };
+    constexpr size_type cols_impl() const noexcept { return _n; };
+
+    constexpr pointer data_impl() { return _packed.data(); };
+    constexpr const_ptr data_impl() const { return _packed.data(); };
+
+    constexpr reference at_impl(size_type i, size_type j) noexcept
+    {
+        return reference(in_triangle(i, j) ? &_packed[_index(i, j)] : nullptr);
+    };
+
+    constexpr const_ref at_impl(size_type i, size_type j) const noexcept
+    {
+        return in_triangle(i, j) ? _packed[_index(i, j)] : _zero;
+    };
+
+    constexpr seoncore::views::MutableTransposedView<self>
+    transposed_impl() noexcept { return seoncore::views::MutableTransposedView<self>(*this); };
+
+    constexpr seoncore::views::TransposedView<self>
+    transposed_impl() const noexcept { return seoncore::views::TransposedView<self>(*this); };
+
+}; // class TriangularMatrix<TN>
+
+}; // namespace seoncore::matrix
+
+#include <seoncore/ops/structured_ops.hpp>
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <vector>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/strided.hpp>
+#include <seoncore/ops/gemm.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::ops
+{
+
+// Vectors shorter than this stay on the calling thread.
+inline constexpr std::size_t blas1_grain = std::size_t{1} << 15;
+
+template <typename TN, bool CX, bool CY>
+TN dot(
+    seoncore::views::BaseVectorView<TN, CX> x,
+    seoncore::views::BaseVectorView<TN, CY> y)
+{
+    assert(x.size() == y.size());
+
+    return seoncore::parallel::parallel_reduce(
+        x.size(), blas1_grain, TN{},
+        [&](std::size_t lo, std::size_t hi)
+        {
+            TN acc{};
+            for (std::size_t i = lo; i < hi; ++i)
+                acc += x[i] * y[i];
+            return acc;
+        },
+        [](TN a, TN b) { return a + b; });
+};
+
+template <typename TN, bool CX>
+TN nrm2(seoncore::views::BaseVectorView<TN, CX> x)
+{
+    using std::sqrt;
+    return sqrt(dot(x, x));
+};
+
+// y += alpha * x
+template <typename TN, bool CX>
+void axpy(
+    TN alpha,
+    seoncore::views::BaseVectorView<TN, CX> x,
+    seoncore::views::MutableVectorView<TN> y)
+{
+    assert(x.size() == y.size());
+
+    seoncore::parallel::parallel_for(x.size(), blas1_grain, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t i = lo; i < hi; ++i)
+            y[i] += alpha * x[i];
+    });
+};
+
+// y = x + beta * y
+template <typename TN, bool CX>
+void xpby(
+    seoncore::views::BaseVectorView<TN, CX> x,
+    TN beta,
+    seoncore::views::MutableVectorView<TN> y)
+{
+    assert(x.size() == y.size());
+
+    seoncore::parallel::parallel_for(x.size(), blas1_grain, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t i = lo; i < hi; ++i)
+            y[i] = x[i] + beta * y[i];
+    });
+};
+
+// x *= alpha
+template <typename TN>
+void scal(TN alpha, seoncore::views::MutableVectorView<TN> x)
+{
+    seoncore::parallel::parallel_for(x.size(), blas1_grain, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t i = lo; i < hi; ++i)
+            x[i] *= alpha;
+    });
+};
+
+// y = x
+template <typename TN, bool CX>
+void copy(
+    seoncore::views::BaseVectorView<TN, CX> x,
+    seoncore::views::MutableVectorView<TN> y)
+{
+    assert(x.size() == y.size());
+
+    seoncore::parallel::parallel_for(x.size(), blas1_grain, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t i = lo; i < hi; ++i)
+            y[i] = x[i];
+    });
+};
+
+template <typename TN>
+void fill(seoncore::views::MutableVectorView<TN> x, TN value)
+{
+    seoncore::parallel::parallel_for(x.size(), blas1_grain, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t i = lo; i < hi; ++i)
+            x[i] = value;
+    });
+};
+
+// A += alpha * x * y^T, walking A in its storage order.
+template <typename TN, class S, bool CX, bool CY>
+void ger(
+    TN alpha,
+    seoncore::views::BaseVectorView<TN, CX> x,
+    seoncore::views::BaseVectorView<TN, CY> y,
+    seoncore::matrix::DenseMatrix<TN, S>& A)
+{
+    assert(A.rows() == x.size() && A.cols() == y.size());
+
+    const auto l = seoncore::matrix::_strided_layout(A);
+    const bool by_row = (A.major() == seoncore::enums::Major::Row);
+    const std::size_t lines = by_row ? l.rows : l.cols;
+    const std::size_t len = by_row ? l.cols : l.rows;
+    const std::ptrdiff_t ls = by_row ? l.rs : l.cs;
+    TN* const a = A.data();
+
+    const std::size_t grain = std::max<std::size_t>(1, blas1_grain / std::max<std::size_t>(1, len));
+    seoncore::parallel::parallel_for(lines, grain, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t i = lo; i < hi; ++i)
+        {
+            TN* line = a + static_cast<std::ptrdiff_t>(i) * ls;
+            const TN f = alpha * (by_row ? x[i] : y[i]);
+            for (std::size_t j = 0; j < len; ++j)
+                line[j] += f * (by_row ? y[j] : x[j]);
+        };
+    });
+};
+
+namespace detail
+{
+
+// Column panel width of syrk; the diagonal block of each panel is the
+// only part computed in full and then cut to its lower triangle.
+inline constexpr std::size_t syrk_block = 128;
+
+// Lower triangle of C (n x n) = alpha * A * A^T + beta * C for A n x k,
+// all on strided storage; the strict upper triangle is not touched.
+// Panel by panel: the diagonal block goes through a scratch tile and the
+// rectangle below it straight into C, both as GEMMs.
+template <typename TN>
+void _syrk_lower(
+    std::size_t n, std::size_t k,
+    TN alpha, const TN* a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+    TN beta, TN* c, std::ptrdiff_t rsc, std::ptrdiff_t csc,
+    bool parallel = true)
+{
+    auto cfg = [&](std::size_t m, std::size_t w)
+    {
+        GemmConfig g = gemm_config<TN>(m, w, k);
+        if (!parallel) g.threads = 1;
+        return g;
+    };
+
+    std::vector<TN> tile(syrk_block * syrk_block);
+    for (std::size_t j0 = 0; j0 < n; j0 += syrk_block)
+    {
+        const std::size_t w = std::min(syrk_block, n - j0);
+        const TN* aj = a + static_cast<std::ptrdiff_t>(j0) * rsa;
+        TN* cj = c + static_cast<std::ptrdiff_t>(j0) * (rsc + csc);
+
+        gemm_with<TN>(cfg(w, w), w, w, k, alpha, aj, rsa, csa, aj, csa, rsa,
+                      TN{0}, tile.data(), static_cast<std::ptrdiff_t>(w), 1);
+        for (std::size_t i = 0; i < w; ++i)
+            for (std::size_t j = 0; j <= i; ++j)
+            {
+                TN& cij = cj[static_cast<std::ptrdiff_t>(i) * rsc + static_cast<std::ptrdiff_t>(j) * csc];
+                cij = tile[i * w + j] + ((beta == TN{0}) ? TN{0} : beta * cij);
+            };
+
+        if (j0 + w < n)
+        {
+            const std::size_t m = n - j0 - w;
+            gemm_with<TN>(cfg(m, w), m, w, k, alpha,
+                          aj + static_cast<std::ptrdiff_t>(w) * rsa, rsa, csa, aj, csa, rsa,
+                          beta, cj + static_cast<std::ptrdiff_t>(w) * rsc, rsc, csc);
+        };
+    };
+};
+
+}; // namespace detail
+
+// Symmetric rank-k update of the lower triangle, as BLAS syrk:
+// C = alpha * A * A^T + beta * C with A n x k. Only the lower triangle of
+// C is read or written. Pass `X.transposed()` for alpha * X^T * X.
+template <seoncore::matrix::StridedDense A, typename TN, class S>
+requires std::same_as<typename A::value_type, TN>
+void syrk(TN alpha, const A& a, TN beta, seoncore::matrix::DenseMatrix<TN, S>& C)
+{
+    assert(C.rows() == C.cols() && C.rows() == a.rows());
+
+    const auto la = seoncore::matrix::_strided_layout(a);
+    const auto lc = seoncore::matrix::_strided_layout(C);
+    detail::_syrk_lower<TN>(la.rows, la.cols, alpha, la.data, la.rs, la.cs, beta, C.data(), lc.rs, lc.cs);
+};
+
+}; // namespace seoncore::ops
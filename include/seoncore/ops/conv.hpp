@@ -0,0 +1,306 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/gemm.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+// Multi-channel 1-D and 2-D convolution on the channels-by-positions
+// matrix layout: an input with C channels of H x W samples is a C x (H*W)
+// DenseMatrix (row c holds channel c, row-major over space), filters are an
+// OC x (C*KH*KW) DenseMatrix with each row ordered [c][ky][kx], and the
+// result is OC x (OH*OW). This is the layout in which the convolution is
+// the product W * im2col(X), which the implicit-GEMM path computes without
+// ever forming im2col(X).
+
+namespace seoncore::ops
+{
+
+// Correlation slides the filter as stored (the deep learning "conv");
+// Convolution flips it along every spatial axis first.
+enum class ConvMode
+{
+    Correlation,
+    Convolution
+};
+
+enum class ConvAlgorithm
+{
+    Auto,
+    Direct,         // blocked direct loop, vectorized over output channels
+    ImplicitGemm    // GEMM micro-kernel, im2col generated while packing
+};
+
+struct Conv1dOptions
+{
+    std::size_t     stride      = 1;
+    std::size_t     padding     = 0;
+    std::size_t     dilation    = 1;
+    ConvMode        mode        = ConvMode::Correlation;
+    ConvAlgorithm   algorithm   = ConvAlgorithm::Auto;
+};
+
+// Per-axis parameters are { vertical, horizontal }.
+struct Conv2dOptions
+{
+    std::array<std::size_t, 2>  stride      = { 1, 1 };
+    std::array<std::size_t, 2>  padding     = { 0, 0 };
+    std::array<std::size_t, 2>  dilation    = { 1, 1 };
+    ConvMode                    mode        = ConvMode::Correlation;
+    ConvAlgorithm               algorithm   = ConvAlgorithm::Auto;
+};
+
+// Output length along one axis; 0 when the dilated filter does not fit.
+constexpr std::size_t conv_output_size(
+    std::size_t in, std::size_t kernel, std::size_t stride, std::size_t padding, std::size_t dilation) noexcept
+{
+    const std::size_t span = dilation * (kernel - 1) + 1;
+    const std::size_t padded = in + 2 * padding;
+    return (kernel == 0 || padded < span) ? 0 : (padded - span) / stride + 1;
+};
+
+namespace detail
+{
+
+struct _conv_geometry
+{
+    std::size_t c, h, w;        // input channels and spatial size
+    std::size_t oc, kh, kw;     // filters
+    std::size_t oh, ow;         // output spatial size
+    std::size_t sy, sx, py, px, dy, dx;
+    bool        flip;
+
+    constexpr std::size_t k() const noexcept { return c * kh * kw; };
+    constexpr std::size_t pixels() const noexcept { return oh * ow; };
+
+    // Column of the filter matrix that multiplies tap (c, ky, kx).
+    constexpr std::size_t tap(std::size_t ci, std::size_t ky, std::size_t kx) const noexcept
+    {
+        if (flip)
+        {
+            ky = kh - 1 - ky;
+            kx = kw - 1 - kx;
+        };
+        return (ci * kh + ky) * kw + kx;
+    };
+};
+
+// Filter matrix as the GEMM A operand: a(o, p) with p in im2col order.
+template <typename TN>
+struct _conv_filter_operand
+{
+    StridedOperand<TN>      w;
+    const _conv_geometry*   g;
+
+    TN operator()(std::size_t o, std::size_t p) const noexcept
+    {
+        const std::size_t kx = p % g->kw;
+        const std::size_t ky = (p / g->kw) % g->kh;
+        const std::size_t ci = p / (g->kw * g->kh);
+        return w(o, g->tap(ci, ky, kx));
+    };
+};
+
+// im2col(X) as the GEMM B operand, evaluated on the fly while packing:
+// b(p, j) is input tap p of output pixel j, or 0 in the padding.
+template <typename TN>
+struct _conv_im2col_operand
+{
+    StridedOperand<TN>      x;
+    const _conv_geometry*   g;
+
+    TN operator()(std::size_t p, std::size_t j) const noexcept
+    {
+        const std::size_t kx = p % g->kw;
+        const std::size_t ky = (p / g->kw) % g->kh;
+        const std::size_t ci = p / (g->kw * g->kh);
+        const std::size_t oy = j / g->ow;
+        const std::size_t ox = j % g->ow;
+
+        const std::size_t iy = oy * g->sy + ky * g->dy;
+        const std::size_t ix = ox * g->sx + kx * g->dx;
+        if (iy < g->py || ix < g->px) return TN{0};
+        if (iy - g->py >= g->h || ix - g->px >= g->w) return TN{0};
+
+        return x(ci, (iy - g->py) * g->w + (ix - g->px));
+    };
+};
+
+template <typename TN>
+void _conv_implicit_gemm(
+    const _conv_geometry& g, StridedOperand<TN> x, StridedOperand<TN> w, TN* out)
+{
+    const std::size_t m = g.oc;
+    const std::size_t n = g.pixels();
+    const std::size_t k = g.k();
+
+    gemm_with<TN>(gemm_config<TN>(m, n, k), m, n, k,
+                  TN{1}, _conv_filter_operand<TN>{ w, &g }, _conv_im2col_operand<TN>{ x, &g },
+                  TN{0}, out, static_cast<std::ptrdiff_t>(n), 1);
+};
+
+// Direct convolution. Filters are repacked tap-major with output channels
+// contiguous, so each input sample is broadcast against a block of OCB
+// output channels held in a fixed-size accumulator. Work is split over
+// (channel block, output row) pairs.
+template <typename TN>
+void _conv_direct(
+    const _conv_geometry& g, StridedOperand<TN> x, StridedOperand<TN> w, TN* out)
+{
+    constexpr std::size_t OCB = 8;
+
+    const std::size_t blocks = (g.oc + OCB - 1) / OCB;
+    const std::size_t ocp = blocks * OCB;
+    const std::size_t taps = g.k();
+
+    std::vector<TN> wt(taps * ocp, TN{0});
+    for (std::size_t o = 0; o < g.oc; ++o)
+        for (std::size_t ci = 0; ci < g.c; ++ci)
+            for (std::size_t ky = 0; ky < g.kh; ++ky)
+                for (std::size_t kx = 0; kx < g.kw; ++kx)
+                    wt[((ci * g.kh + ky) * g.kw + kx) * ocp + o] = w(o, g.tap(ci, ky, kx));
+
+    const std::size_t npix = g.pixels();
+    const std::size_t units = blocks * g.oh;
+
+    seoncore::parallel::parallel_for(units, 1, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t u = lo; u < hi; ++u)
+        {
+            const std::size_t ob = u / g.oh;
+            const std::size_t oy = u % g.oh;
+            const std::size_t o0 = ob * OCB;
+            const std::size_t nb = std::min(OCB, g.oc - o0);
+
+            for (std::size_t ox = 0; ox < g.ow; ++ox)
+            {
+                TN acc[OCB] = {};
+
+                for (std::size_t ci = 0; ci < g.c; ++ci)
+                    for (std::size_t ky = 0; ky < g.kh; ++ky)
+                    {
+                        const std::size_t iy = oy * g.sy + ky * g.dy;
+                        if (iy < g.py || iy - g.py >= g.h) continue;
+
+                        for (std::size_t kx = 0; kx < g.kw; ++kx)
+                        {
+                            const std::size_t ix = ox * g.sx + kx * g.dx;
+                            if (ix < g.px || ix - g.px >= g.w) continue;
+
+                            const TN xv = x(ci, (iy - g.py) * g.w + (ix - g.px));
+                            const TN* wp = wt.data() + ((ci * g.kh + ky) * g.kw + kx) * ocp + o0;
+                            for (std::size_t o = 0; o < OCB; ++o)
+                                acc[o] += xv * wp[o];
+                        };
+                    };
+
+                const std::size_t pix = oy * g.ow + ox;
+                for (std::size_t o = 0; o < nb; ++o)
+                    out[(o0 + o) * npix + pix] = acc[o];
+            };
+        };
+    });
+};
+
+template <typename TN, class SX, class SW>
+seoncore::matrix::DenseMatrix<TN> _conv(
+    const seoncore::matrix::DenseMatrix<TN, SX>& x,
+    const seoncore::matrix::DenseMatrix<TN, SW>& w,
+    const _conv_geometry& g,
+    ConvAlgorithm algorithm,
+    [[maybe_unused]] const char* name)
+{
+    static_assert(std::is_arithmetic_v<TN>, "conv: arithmetic element type required");
+
+    seoncore::matrix::DenseMatrix<TN> out(g.oc, g.pixels());
+    if (g.oc == 0 || g.pixels() == 0) return out;
+
+    const auto [rsx, csx] = seoncore::matrix::_dense_strides(x);
+    const auto [rsw, csw] = seoncore::matrix::_dense_strides(w);
+    const StridedOperand<TN> xs { x.data(), rsx, csx };
+    const StridedOperand<TN> ws { w.data(), rsw, csw };
+
+    // The GEMM path pays for decoding im2col indices while packing, which
+    // only amortizes once enough output channels reuse each packed panel.
+    if (algorithm == ConvAlgorithm::Auto)
+        algorithm = (g.oc >= 32 && g.k() >= 16) ? ConvAlgorithm::ImplicitGemm : ConvAlgorithm::Direct;
+
+    [[maybe_unused]] const double flops = 2.0 * g.oc * g.k() * g.pixels();
+    [[maybe_unused]] const double bytes = static_cast<double>(x.size() + w.size() + out.size()) * sizeof(TN);
+    SEONCORE_OP_SCOPE(name, seoncore::enums::Path::Direct, g.oc, g.pixels(), g.k(), flops, bytes);
+
+    if (algorithm == ConvAlgorithm::ImplicitGemm)
+        _conv_implicit_gemm<TN>(g, xs, ws, out.data());
+    else
+        _conv_direct<TN>(g, xs, ws, out.data());
+
+    return out;
+};
+
+}; // namespace detail
+
+// 2-D convolution of x (C x (height*width)) with filters w (OC x (C*kh*kw)).
+// Returns OC x (OH*OW), OH and OW per conv_output_size.
+template <typename TN, class SX, class SW>
+seoncore::matrix::DenseMatrix<TN> conv2d(
+    const seoncore::matrix::DenseMatrix<TN, SX>& x,
+    std::size_t height,
+    std::size_t width,
+    const seoncore::matrix::DenseMatrix<TN, SW>& w,
+    std::size_t kh,
+    std::size_t kw,
+    const Conv2dOptions& opts = {})
+{
+    assert(x.cols() == height * width);
+    assert(w.cols() == x.rows() * kh * kw);
+    assert(opts.stride[0] > 0 && opts.stride[1] > 0);
+    assert(opts.dilation[0] > 0 && opts.dilation[1] > 0);
+
+    detail::_conv_geometry g {
+        x.rows(), height, width,
+        w.rows(), kh, kw,
+        conv_output_size(height, kh, opts.stride[0], opts.padding[0], opts.dilation[0]),
+        conv_output_size(width,  kw, opts.stride[1], opts.padding[1], opts.dilation[1]),
+        opts.stride[0], opts.stride[1],
+        opts.padding[0], opts.padding[1],
+        opts.dilation[0], opts.dilation[1],
+        opts.mode == ConvMode::Convolution
+    };
+
+    return detail::_conv(x, w, g, opts.algorithm, "conv2d");
+};
+
+// 1-D convolution of x (C x length) with filters w (OC x (C*kw)); the
+// filter width is w.cols() / C. Returns OC x OL.
+template <typename TN, class SX, class SW>
+seoncore::matrix::DenseMatrix<TN> conv1d(
+    const seoncore::matrix::DenseMatrix<TN, SX>& x,
+    const seoncore::matrix::DenseMatrix<TN, SW>& w,
+    const Conv1dOptions& opts = {})
+{
+    assert(x.rows() > 0 && w.cols() % x.rows() == 0);
+    assert(opts.stride > 0 && opts.dilation > 0);
+
+    const std::size_t kw = w.cols() / x.rows();
+
+    detail::_conv_geometry g {
+        x.rows(), 1, x.cols(),
+        w.rows(), 1, kw,
+        1, conv_output_size(x.cols(), kw, opts.stride, opts.padding, opts.dilation),
+        1, opts.stride,
+        0, opts.padding,
+        1, opts.dilation,
+        opts.mode == ConvMode::Convolution
+    };
+
+    return detail::_conv(x, w, g, opts.algorithm, "conv1d");
+};
+
+}; // namespace seoncore::ops
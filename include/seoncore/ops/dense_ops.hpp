@@ -1,22 +1,53 @@
 #pragma once
 
+#include <concepts>
+#include <type_traits>
+#include <seoncore/enums/major.hpp>
 #include <seoncore/ops/matmul.hpp>
+#include <seoncore/ops/gemm.hpp>
+#include <seoncore/ops/elementwise.hpp>
+#include <seoncore/ops/epilogue.hpp>
 #include <seoncore/ops/transform.hpp>
 #include <seoncore/views/vec.hpp>
 #include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/strided.hpp>
 
 namespace seoncore::matrix
 {
 
-template <typename TN>
+// (row stride, column stride) of a dense matrix's storage.
+template <typename TN, class S>
+constexpr std::pair<std::ptrdiff_t, std::ptrdiff_t> _dense_strides(const DenseMatrix<TN, S>& M) noexcept
+{
+    if (M.major() == seoncore::enums::Major::Row)
+        return { static_cast<std::ptrdiff_t>(M.cols()), 1 };
+    return { 1, static_cast<std::ptrdiff_t>(M.rows()) };
+};
+
+template <typename TN, class SA, class SB>
 constexpr auto tag_invoke(
     seoncore::tags::matmul_t,
-    const seoncore::matrix::DenseMatrix<TN>& A,
-    const seoncore::matrix::DenseMatrix<TN>& B)
+    const seoncore::matrix::DenseMatrix<TN, SA>& A,
+    const seoncore::matrix::DenseMatrix<TN, SB>& B)
 {
     assert(A.cols() == B.rows());
 
-    seoncore::matrix::DenseMatrix<TN> C(A.rows(), B.cols());
+    seoncore::matrix::DenseMatrix<TN, SA> C(A.rows(), B.cols());
+
+    if constexpr (std::is_arithmetic_v<TN>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto [rsa, csa] = _dense_strides(A);
+            const auto [rsb, csb] = _dense_strides(B);
+            const auto [rsc, csc] = _dense_strides(C);
+
+            seoncore::ops::gemm<TN>(A.rows(), B.cols(), A.cols(),
+                                    TN{1}, A.data(), rsa, csa, B.data(), rsb, csb,
+                                    TN{0}, C.data(), rsc, csc);
+            return C;
+        };
+    };
 
     for (std::size_t i = 0; i < A.rows(); ++i)
     {
@@ -30,12 +61,115 @@ constexpr auto tag_invoke(
     return C;
 };
 
-template <typename TN>
+// Products with a transposed view on either side, nested or not. The view
+// reaches the kernel as its base's storage with the strides swapped, and
+// packing reads straight from there, so A^T * B and A * B^T cost what
+// A * B does.
+template <StridedDense A, StridedDense B>
+requires std::same_as<typename A::value_type, typename B::value_type>
+      && (is_transposed_view_v<A> || is_transposed_view_v<B>)
+constexpr auto tag_invoke(seoncore::tags::matmul_t, const A& a, const B& b)
+{
+    using TN = typename A::value_type;
+
+    assert(a.cols() == b.rows());
+
+    seoncore::matrix::DenseMatrix<TN> C(a.rows(), b.cols());
+
+    if constexpr (std::is_arithmetic_v<TN>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const StridedLayout<TN> la = _strided_layout(a);
+            const StridedLayout<TN> lb = _strided_layout(b);
+            const auto [rsc, csc] = _dense_strides(C);
+
+            seoncore::ops::gemm<TN>(la.rows, lb.cols, la.cols,
+                                    TN{1}, la.data, la.rs, la.cs, lb.data, lb.rs, lb.cs,
+                                    TN{0}, C.data(), rsc, csc);
+            return C;
+        };
+    };
+
+    for (std::size_t i = 0; i < a.rows(); ++i)
+    {
+        for (std::size_t k = 0; k < a.cols(); ++k)
+        {
+            const TN aik = a(i, k);
+            for (std::size_t j = 0; j < b.cols(); ++j)
+                C(i, j) += aik * b(k, j);
+        };
+    };
+    return C;
+};
+
+// Fused forms: the epilogue runs on the GEMM register tile. A and B may be
+// dense matrices or transposed views of them.
+template <StridedDense A, StridedDense B, typename TN, class SC, seoncore::ops::GemmEpilogueLike E>
+requires std::is_arithmetic_v<TN>
+      && std::same_as<typename A::value_type, TN> && std::same_as<typename B::value_type, TN>
+      && std::same_as<typename E::value_type, TN>
+void tag_invoke(
+    seoncore::tags::matmul_t,
+    const A& a,
+    const B& b,
+    seoncore::matrix::DenseMatrix<TN, SC>& C,
+    const E& epi)
+{
+    assert(a.cols() == b.rows());
+    assert(C.rows() == a.rows() && C.cols() == b.cols());
+
+    const StridedLayout<TN> la = _strided_layout(a);
+    const StridedLayout<TN> lb = _strided_layout(b);
+    const auto [rsc, csc] = _dense_strides(C);
+    const std::size_t m = la.rows;
+    const std::size_t n = lb.cols;
+    const std::size_t k = la.cols;
+
+    seoncore::ops::gemm_with<TN>(
+        seoncore::ops::gemm_config<TN>(m, n, k), m, n, k,
+        epi.alpha, seoncore::ops::StridedOperand<TN>{ la.data, la.rs, la.cs },
+        seoncore::ops::StridedOperand<TN>{ lb.data, lb.rs, lb.cs },
+        epi.beta, C.data(), rsc, csc, &epi);
+};
+
+// Result of a fused product: A's storage type when A is a matrix.
+template <class A>
+struct _fused_result
+{
+    using type = seoncore::matrix::DenseMatrix<typename A::value_type>;
+};
+
+template <typename TN, class S>
+struct _fused_result<seoncore::matrix::DenseMatrix<TN, S>>
+{
+    using type = seoncore::matrix::DenseMatrix<TN, S>;
+};
+
+template <StridedDense A, StridedDense B, seoncore::ops::GemmEpilogueLike E>
+requires std::is_arithmetic_v<typename A::value_type>
+      && std::same_as<typename B::value_type, typename A::value_type>
+      && std::same_as<typename E::value_type, typename A::value_type>
+auto tag_invoke(
+    seoncore::tags::matmul_t tag,
+    const A& a,
+    const B& b,
+    const E& epi)
+{
+    typename _fused_result<A>::type C(a.rows(), b.cols());
+
+    E fresh = epi;
+    fresh.beta = typename A::value_type{0};
+    tag_invoke(tag, a, b, C, fresh);
+    return C;
+};
+
+template <typename TN, class S>
 constexpr auto tag_invoke(
     seoncore::tags::abs_t,
-    const seoncore::matrix::DenseMatrix<TN>& A)
+    const seoncore::matrix::DenseMatrix<TN, S>& A)
 {
-    seoncore::matrix::DenseMatrix<TN> tmp(A);
+    seoncore::matrix::DenseMatrix<TN, S> tmp(A);
     seoncore::views::MutableVectorView<TN> tmpv = tmp.flatten();
     for (auto& elem : tmpv)
         if (elem < TN{0}) elem *= -1;
@@ -43,4 +177,25 @@ constexpr auto tag_invoke(
     return tmp;
 };
 
+// Same storage order: one flat pass over the buffers through the
+// vectorizable kernels in ops/math.hpp.
+template <seoncore::ops::math::Fn F, std::floating_point TN, class SA, class SD>
+void tag_invoke(
+    seoncore::tags::math_t<F>,
+    const seoncore::matrix::DenseMatrix<TN, SA>& A,
+    seoncore::matrix::DenseMatrix<TN, SD>& D,
+    TN p,
+    seoncore::ops::math::Accuracy acc)
+{
+    assert(A.rows() == D.rows() && A.cols() == D.cols());
+
+    if (A.major() == D.major())
+    {
+        seoncore::ops::math::transform_n<F>(A.data(), D.data(), A.rows() * A.cols(), p, acc);
+        return;
+    };
+
+    seoncore::ops::math_fallback<F>(A, D, p, acc);
+};
+
 }; // namespace seoncore::matrix
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/strided.hpp>
+#include <seoncore/ops/gemm.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+// Distances between the rows of two point sets, A (m x d) and B (n x d),
+// through the expansion |a - b|^2 = |a|^2 + |b|^2 - 2 a.b: the cross terms
+// are one GEMM of A against B^T, and the norms and the metric itself are
+// applied in the GEMM epilogue. Either operand may be a DenseMatrix or a
+// transposed view of one.
+//
+// The expansion loses relative accuracy for points much closer together
+// than their norms (about sqrt(eps) * |a| for the Euclidean distance);
+// center the data first if that matters.
+
+namespace seoncore::ops
+{
+
+enum class DistanceMetric
+{
+    SquaredEuclidean,
+    Euclidean,
+    Cosine          // 1 - cos(a, b); a zero vector is at distance 1 from anything
+};
+
+// Query rows sorted by increasing distance to their k nearest corpus rows.
+template <typename TN>
+struct KnnResult
+{
+    seoncore::matrix::DenseMatrix<std::size_t>  indices;    // m x k, rows of B
+    seoncore::matrix::DenseMatrix<TN>           distances;  // m x k
+};
+
+namespace detail
+{
+
+// Query rows per k-NN work item and corpus rows per distance tile; a tile
+// of doubles is 256 KB and stays in L2 while its rows are scanned.
+inline constexpr std::size_t knn_query_block = 64;
+inline constexpr std::size_t knn_corpus_block = 512;
+
+// |row i|^2 for every row (Euclidean), or 1 / |row i| (Cosine).
+template <typename TN>
+std::vector<TN> _row_norms(const seoncore::matrix::StridedLayout<TN>& x, DistanceMetric metric)
+{
+    std::vector<TN> out(x.rows);
+    seoncore::parallel::parallel_for(x.rows, 256, [&](std::size_t lo, std::size_t hi)
+    {
+        for (std::size_t i = lo; i < hi; ++i)
+        {
+            const TN* p = x.data + static_cast<std::ptrdiff_t>(i) * x.rs;
+            TN acc{};
+            for (std::size_t j = 0; j < x.cols; ++j)
+            {
+                const TN v = p[static_cast<std::ptrdiff_t>(j) * x.cs];
+                acc += v * v;
+            };
+
+            if (metric == DistanceMetric::Cosine)
+                out[i] = (acc > TN{0}) ? TN{1} / std::sqrt(acc) : TN{0};
+            else
+                out[i] = acc;
+        };
+    });
+    return out;
+};
+
+// Turns the GEMM result (-2 a.b, or a.b for Cosine) into the metric at
+// output (i, j); a and b point at the norms of the rows in this product.
+template <typename TN>
+struct _distance_epilogue
+{
+    using value_type = TN;
+
+    TN              alpha;
+    TN              beta    = TN{0};
+    const TN*       a;
+    const TN*       b;
+    DistanceMetric  metric;
+
+    TN finish(std::size_t i, std::size_t j, TN v) const noexcept
+    {
+        if (metric == DistanceMetric::Cosine)
+            return TN{1} - v * a[i] * b[j];
+
+        const TN d2 = std::max(a[i] + b[j] + v, TN{0});
+        return (metric == DistanceMetric::Euclidean) ? std::sqrt(d2) : d2;
+    };
+};
+
+template <typename TN>
+constexpr TN _distance_alpha(DistanceMetric metric) noexcept
+{
+    return (metric == DistanceMetric::Cosine) ? TN{1} : TN{-2};
+};
+
+// Order of k-NN candidates (distance, index): by distance, then index. A
+// NaN distance ranks as +infinity, so the heap still sees a strict weak
+// ordering when the inputs hold NaN.
+struct _knn_less
+{
+    template <typename TN>
+    bool operator()(const std::pair<TN, std::size_t>& x, const std::pair<TN, std::size_t>& y) const noexcept
+    {
+        constexpr TN inf = std::numeric_limits<TN>::infinity();
+        const TN dx = std::isnan(x.first) ? inf : x.first;
+        const TN dy = std::isnan(y.first) ? inf : y.first;
+        return dx < dy || (dx == dy && x.second < y.second);
+    };
+};
+
+}; // namespace detail
+
+// m x n matrix of distances from each row of A to each row of B.
+template <seoncore::matrix::StridedDense A, seoncore::matrix::StridedDense B>
+requires std::floating_point<typename A::value_type> && std::same_as<typename A::value_type, typename B::value_type>
+seoncore::matrix::DenseMatrix<typename A::value_type> pairwise_distances(
+    const A& a, const B& b, DistanceMetric metric = DistanceMetric::Euclidean)
+{
+    using TN = typename A::value_type;
+    using seoncore::matrix::_strided_layout;
+
+    assert(a.cols() == b.cols());
+
+    const auto la = _strided_layout(a);
+    const auto lbt = _strided_layout(b).transposed();     // d x n
+    const std::size_t m = la.rows, n = lbt.cols, d = la.cols;
+
+    SEONCORE_OP_SCOPE("pairwise_distances", seoncore::enums::Path::Direct, m, n, d, 2.0 * m * n * d,
+                      static_cast<double>(m * d + n * d + m * n) * sizeof(TN));
+
+    const std::vector<TN> na = detail::_row_norms(la, metric);
+    const std::vector<TN> nb = detail::_row_norms(lbt.transposed(), metric);
+    const detail::_distance_epilogue<TN> epi{ detail::_distance_alpha<TN>(metric), TN{0}, na.data(), nb.data(), metric };
+
+    seoncore::matrix::DenseMatrix<TN> out(m, n);
+    gemm_with<TN>(gemm_config<TN>(m, n, d), m, n, d,
+                  epi.alpha, StridedOperand<TN>{ la.data, la.rs, la.cs }, StridedOperand<TN>{ lbt.data, lbt.rs, lbt.cs },
+                  TN{0}, out.data(), static_cast<std::ptrdiff_t>(n), 1, &epi);
+    return out;
+};
+
+// The k rows of B nearest to each row of A (k is clamped to B's rows).
+// Query rows are split into blocks across the pool; each block walks B in
+// tiles, computing one tile of distances at a time with the GEMM kernel
+// and feeding it into a bounded max-heap per query row, so only
+// `knn_query_block x knn_corpus_block` distances exist at any moment.
+// Ties go to the lower index and NaN distances come last; the result
+// does not depend on the thread count.
+template <seoncore::matrix::StridedDense A, seoncore::matrix::StridedDense B>
+requires std::floating_point<typename A::value_type> && std::same_as<typename A::value_type, typename B::value_type>
+KnnResult<typename A::value_type> knn(
+    const A& a, const B& b, std::size_t k, DistanceMetric metric = DistanceMetric::Euclidean)
+{
+    using TN = typename A::value_type;
+    using seoncore::matrix::_strided_layout;
+    using entry = std::pair<TN, std::size_t>;
+    constexpr detail::_knn_less less{};
+
+    assert(a.cols() == b.cols());
+
+    const auto la = _strided_layout(a);
+    const auto lbt = _strided_layout(b).transposed();
+    const std::size_t m = la.rows, n = lbt.cols, d = la.cols;
+    k = std::min(k, n);
+
+    SEONCORE_OP_SCOPE("knn", seoncore::enums::Path::Direct, m, n, d, 2.0 * m * n * d,
+                      static_cast<double>(m * d + n * d) * sizeof(TN));
+
+    KnnResult<TN> result{ seoncore::matrix::DenseMatrix<std::size_t>(m, k), seoncore::matrix::DenseMatrix<TN>(m, k) };
+    if (m == 0 || k == 0) return result;
+
+    const std::vector<TN> na = detail::_row_norms(la, metric);
+    const std::vector<TN> nb = detail::_row_norms(lbt.transposed(), metric);
+
+    constexpr std::size_t QB = detail::knn_query_block;
+    constexpr std::size_t NB = detail::knn_corpus_block;
+    const std::size_t blocks = (m + QB - 1) / QB;
+
+    seoncore::parallel::parallel_for(blocks, 1, [&](std::size_t lo, std::size_t hi)
+    {
+        std::vector<TN> tile(QB * NB);
+        std::vector<entry> heaps(QB * k);
+        std::vector<std::size_t> sizes(QB);
+
+        for (std::size_t blk = lo; blk < hi; ++blk)
+        {
+            const std::size_t i0 = blk * QB;
+            const std::size_t mb = std::min(QB, m - i0);
+            std::fill(sizes.begin(), sizes.end(), 0);
+
+            for (std::size_t j0 = 0; j0 < n; j0 += NB)
+            {
+                const std::size_t nbk = std::min(NB, n - j0);
+
+                // One thread per tile: the pool is already busy with other blocks.
+                GemmConfig cfg = gemm_config<TN>(mb, nbk, d);
+                cfg.threads = 1;
+
+                const detail::_distance_epilogue<TN> epi{
+                    detail::_distance_alpha<TN>(metric), TN{0}, na.data() + i0, nb.data() + j0, metric };
+                gemm_with<TN>(cfg, mb, nbk, d, epi.alpha,
+                              StridedOperand<TN>{ la.data + static_cast<std::ptrdiff_t>(i0) * la.rs, la.rs, la.cs },
+                              StridedOperand<TN>{ lbt.data + static_cast<std::ptrdiff_t>(j0) * lbt.cs, lbt.rs, lbt.cs },
+                              TN{0}, tile.data(), static_cast<std::ptrdiff_t>(nbk), 1, &epi);
+
+                for (std::size_t i = 0; i < mb; ++i)
+                {
+                    entry* heap = heaps.data() + i * k;
+                    std::size_t& size = sizes[i];
+                    const TN* row = tile.data() + i * nbk;
+
+                    for (std::size_t j = 0; j < nbk; ++j)
+                    {
+                        const entry e{ row[j], j0 + j };
+                        if (size < k)
+                        {
+                            heap[size++] = e;
+                            std::push_heap(heap, heap + size, less);
+                        }
+                        else if (less(e, heap[0]))
+                        {
+                            std::pop_heap(heap, heap + k, less);
+                            heap[k - 1] = e;
+                            std::push_heap(heap, heap + k, less);
+                        };
+                    };
+                };
+            };
+
+            for (std::size_t i = 0; i < mb; ++i)
+            {
+                entry* heap = heaps.data() + i * k;
+                std::sort_heap(heap, heap + k, less);
+                for (std::size_t t = 0; t < k; ++t)
+                {
+                    result.distances(i0 + i, t) = heap[t].first;
+                    result.indices(i0 + i, t) = heap[t].second;
+                };
+            };
+        };
+    });
+
+    return result;
+};
+
+}; // namespace seoncore::ops
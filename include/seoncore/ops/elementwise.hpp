@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/matrix/dense_fwd.hpp>
+#include <seoncore/ops/math.hpp>
+#include <seoncore/ops/tag_invoke.hpp>
+
+namespace seoncore::tags
+{
+
+// One tag per elementwise math function. Overloads take
+// (src, dest, param, accuracy) and write f(src) into dest, which may be
+// src itself; param is the exponent for pow and unused otherwise.
+template <seoncore::ops::math::Fn F>
+struct math_t
+{
+
+static constexpr seoncore::ops::math::Fn fn = F;
+
+template <class... Args>
+constexpr auto operator()(Args&&... args) const
+    noexcept(noexcept(tag_invoke(*this, std::forward<Args>(args)...)))
+    -> decltype(tag_invoke(*this, std::forward<Args>(args)...))
+{
+    return tag_invoke(*this, std::forward<Args>(args)...);
+};
+
+}; // struct math_t<F>
+
+using exp_t     = math_t<seoncore::ops::math::Fn::Exp>;
+using log_t     = math_t<seoncore::ops::math::Fn::Log>;
+using tanh_t    = math_t<seoncore::ops::math::Fn::Tanh>;
+using sigmoid_t = math_t<seoncore::ops::math::Fn::Sigmoid>;
+using sqrt_t    = math_t<seoncore::ops::math::Fn::Sqrt>;
+using pow_t     = math_t<seoncore::ops::math::Fn::Pow>;
+
+inline constexpr exp_t      exp{};
+inline constexpr log_t      log{};
+inline constexpr tanh_t     tanh{};
+inline constexpr sigmoid_t  sigmoid{};
+inline constexpr sqrt_t     sqrt{};
+inline constexpr pow_t      pow{};
+
+template <class T>
+inline constexpr bool is_math_tag_v = false;
+
+template <seoncore::ops::math::Fn F>
+inline constexpr bool is_math_tag_v<math_t<F>> = true;
+
+}; // namespace seoncore::tags
+
+
+namespace seoncore::ops
+{
+
+using math::Accuracy;
+
+template <math::Fn F, class A, class D, class TN>
+concept has_tagged_math =
+requires(A&& a, D&& d, TN p, Accuracy acc)
+{
+    tag_invoke(seoncore::tags::math_t<F>{}, std::forward<A>(a), std::forward<D>(d), p, acc);
+};
+
+template <math::Fn F, seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike D>
+constexpr void math_fallback(const A& a, D& dest, typename A::value_type p, Accuracy acc)
+{
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            dest(i, j) = math::eval<F>(a(i, j), p, acc);
+};
+
+// dest = f(a) elementwise; dest must have a's shape and may be a itself.
+template <math::Fn F, seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike D>
+requires std::floating_point<typename A::value_type> && std::same_as<typename A::value_type, typename D::value_type>
+void math_into(const A& a, D& dest, typename A::value_type p = {}, Accuracy acc = math::default_accuracy)
+{
+    using value_type = typename A::value_type;
+
+    assert(a.rows() == dest.rows() && a.cols() == dest.cols());
+
+    [[maybe_unused]] const std::size_t n = a.rows() * a.cols();
+    [[maybe_unused]] const double bytes = 2.0 * n * sizeof(value_type);
+
+    if constexpr (has_tagged_math<F, const A&, D&, value_type>)
+    {
+        SEONCORE_OP_SCOPE(math::name(F), seoncore::enums::Path::Tagged, a.rows(), a.cols(), 0, n, bytes);
+        tag_invoke(seoncore::tags::math_t<F>{}, a, dest, p, acc);
+    }
+    else
+    {
+        SEONCORE_OP_SCOPE(math::name(F), seoncore::enums::Path::Fallback, a.rows(), a.cols(), 0, n, bytes);
+        math_fallback<F>(a, dest, p, acc);
+    };
+};
+
+namespace detail
+{
+
+// A fresh matrix to hold f(a): same storage and order as a dense `a`.
+template <class A>
+auto _math_result(const A& a)
+{
+    return seoncore::matrix::DenseMatrix<typename A::value_type>(a.rows(), a.cols());
+};
+
+template <typename TN, class S>
+auto _math_result(const seoncore::matrix::DenseMatrix<TN, S>& a)
+{
+    return seoncore::matrix::DenseMatrix<TN, S>(a.rows(), a.cols(), a.major());
+};
+
+template <math::Fn F, class A>
+auto _math(const A& a, typename A::value_type p, Accuracy acc)
+{
+    auto out = _math_result(a);
+    math_into<F>(a, out, p, acc);
+    return out;
+};
+
+}; // namespace detail
+
+template <class A>
+concept FloatMatrix = seoncore::concepts::MatrixLike<A> && std::floating_point<typename A::value_type>;
+
+// ops::f(a) returns a new matrix; ops::f(a, dest) writes into dest, and
+// ops::f(m, m) works in place. The accuracy defaults to
+// math::default_accuracy (see ops/math.hpp for the error bounds).
+
+template <FloatMatrix A>
+auto exp(const A& a, Accuracy acc = math::default_accuracy) { return detail::_math<math::Fn::Exp>(a, {}, acc); };
+
+template <FloatMatrix A, FloatMatrix D>
+void exp(const A& a, D& dest, Accuracy acc = math::default_accuracy) { math_into<math::Fn::Exp>(a, dest, {}, acc); };
+
+template <FloatMatrix A>
+auto log(const A& a, Accuracy acc = math::default_accuracy) { return detail::_math<math::Fn::Log>(a, {}, acc); };
+
+template <FloatMatrix A, FloatMatrix D>
+void log(const A& a, D& dest, Accuracy acc = math::default_accuracy) { math_into<math::Fn::Log>(a, dest, {}, acc); };
+
+template <FloatMatrix A>
+auto tanh(const A& a, Accuracy acc = math::default_accuracy) { return detail::_math<math::Fn::Tanh>(a, {}, acc); };
+
+template <FloatMatrix A, FloatMatrix D>
+void tanh(const A& a, D& dest, Accuracy acc = math::default_accuracy) { math_into<math::Fn::Tanh>(a, dest, {}, acc); };
+
+template <FloatMatrix A>
+auto sigmoid(const A& a, Accuracy acc = math::default_accuracy) { return detail::_math<math::Fn::Sigmoid>(a, {}, acc); };
+
+template <FloatMatrix A, FloatMatrix D>
+void sigmoid(const A& a, D& dest, Accuracy acc = math::default_accuracy) { math_into<math::Fn::Sigmoid>(a, dest, {}, acc); };
+
+template <FloatMatrix A>
+auto sqrt(const A& a, Accuracy acc = math::default_accuracy) { return detail::_math<math::Fn::Sqrt>(a, {}, acc); };
+
+template <FloatMatrix A, FloatMatrix D>
+void sqrt(const A& a, D& dest, Accuracy acc = math::default_accuracy) { math_into<math::Fn::Sqrt>(a, dest, {}, acc); };
+
+template <FloatMatrix A>
+auto pow(const A& a, typename A::value_type p, Accuracy acc = math::default_accuracy)
+{
+    return detail::_math<math::Fn::Pow>(a, p, acc);
+};
+
+template <FloatMatrix A, FloatMatrix D>
+void pow(const A& a, typename A::value_type p, D& dest, Accuracy acc = math::default_accuracy)
+{
+    math_into<math::Fn::Pow>(a, dest, p, acc);
+};
+
+}; // namespace seoncore::ops
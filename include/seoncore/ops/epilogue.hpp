@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/elementwise.hpp>
+#include <seoncore/ops/transform.hpp>
+
+namespace seoncore::ops
+{
+
+namespace epilogue
+{
+
+struct identity_t
+{
+    template <typename TN>
+    constexpr TN operator()(TN v) const noexcept { return v; };
+};
+
+struct relu_t
+{
+    template <typename TN>
+    constexpr TN operator()(TN v) const noexcept { return (v > TN{0}) ? v : TN{0}; };
+};
+
+// tanh approximation of GELU, as used by most frameworks.
+struct gelu_t
+{
+    template <typename TN>
+    TN operator()(TN v) const noexcept
+    {
+        using std::tanh;
+        constexpr TN c = TN(0.7978845608028654);    // sqrt(2 / pi)
+        return TN(0.5) * v * (TN{1} + tanh(c * (v + TN(0.044715) * v * v * v)));
+    };
+};
+
+inline constexpr identity_t  identity{};
+inline constexpr relu_t      relu{};
+inline constexpr gelu_t      gelu{};
+
+// Applies an elementwise functor to one value. Matrix op tags (abs_t and
+// the unary math tags such as tags::exp) are accepted too and mean their
+// scalar counterpart.
+template <typename TN, class F>
+constexpr TN apply(const F& f, TN v)
+{
+    if constexpr (std::is_same_v<F, seoncore::tags::abs_t>)
+        return (v < TN{0}) ? -v : v;
+    else if constexpr (seoncore::tags::is_math_tag_v<F>)
+    {
+        static_assert(F::fn != math::Fn::Pow, "pow takes an exponent; use a lambda");
+        return math::eval<F::fn, math::default_accuracy>(v, TN{});
+    }
+    else
+        return static_cast<TN>(f(v));
+};
+
+}; // namespace epilogue
+
+// What happens to each output element of a product before it is stored:
+//
+//   C(i, j) = fn(alpha * (A * B)(i, j) + beta * C(i, j) + row_bias[j] + col_bias[i])
+//
+// An empty bias view is skipped. For products that go through the blocked
+// GEMM this runs on the register tile, so the whole chain costs one write
+// of C. beta only matters for matmul_into, where C holds prior values.
+template <typename TN, class F = epilogue::identity_t>
+struct GemmEpilogue
+{
+    using value_type = TN;
+
+    TN                                  alpha       = TN{1};
+    TN                                  beta        = TN{0};
+    seoncore::views::VectorView<TN>     row_bias    {};     // length n, broadcast down the rows
+    seoncore::views::VectorView<TN>     col_bias    {};     // length m, broadcast along the columns
+    F                                   fn          {};
+
+    // Everything after the alpha/beta combination, at output (i, j).
+    constexpr TN finish(std::size_t i, std::size_t j, TN v) const
+    {
+        if (!row_bias.empty()) v += row_bias[j];
+        if (!col_bias.empty()) v += col_bias[i];
+        return epilogue::apply<TN>(fn, v);
+    };
+};
+
+template <class E>
+concept GemmEpilogueLike =
+requires(const E& e, std::size_t i)
+{
+    typename E::value_type;
+    { e.alpha } -> std::convertible_to<typename E::value_type>;
+    { e.beta } -> std::convertible_to<typename E::value_type>;
+    { e.finish(i, i, e.alpha) } -> std::convertible_to<typename E::value_type>;
+};
+
+template <typename TN, class F>
+constexpr GemmEpilogue<TN, F> make_epilogue(F fn, TN alpha = TN{1}, TN beta = TN{0})
+{
+    return { alpha, beta, {}, {}, fn };
+};
+
+}; // namespace seoncore::ops
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <seoncore/ops/gemm_profile.hpp>
+#include <seoncore/ops/gemm_kernel.hpp>
+#include <seoncore/ops/gemm_tune.hpp>
+
+namespace seoncore::ops
+{
+
+// Where the per-machine profile lives: $SEONCORE_GEMM_PROFILE, else
+// $XDG_CACHE_HOME/seoncore/gemm.profile, else ~/.cache/seoncore/gemm.profile.
+// Empty when none of these is set.
+inline std::string gemm_profile_path()
+{
+    if (const char* p = std::getenv("SEONCORE_GEMM_PROFILE"))
+        return p;
+    if (const char* x = std::getenv("XDG_CACHE_HOME"); x && *x)
+        return std::string(x) + "/seoncore/gemm.profile";
+    if (const char* h = std::getenv("HOME"); h && *h)
+        return std::string(h) + "/.cache/seoncore/gemm.profile";
+    return {};
+};
+
+// Tunes float and double GEMM on this host, writes the profile to `path`
+// (creating its directory) and makes it the active one. Returns false if
+// the file could not be written; the profile is installed either way.
+inline bool tune_gemm_profile(const std::string& path = gemm_profile_path(), const GemmTuneOptions& opts = {});
+
+namespace detail
+{
+
+inline GemmProfile _startup_gemm_profile()
+{
+    const std::string path = gemm_profile_path();
+    GemmProfile p = path.empty() ? GemmProfile{} : GemmProfile::load(path);
+
+    // Tuning mode: SEONCORE_GEMM_TUNE=1 tunes on first use when no profile
+    // exists yet and persists the result for later runs.
+    const char* tune = std::getenv("SEONCORE_GEMM_TUNE");
+    if (p.empty() && tune && std::string_view(tune) != "0")
+    {
+        tune_gemm<float>(p);
+        tune_gemm<double>(p);
+        if (!path.empty())
+        {
+            std::error_code ec;
+            std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+            p.save(path);
+        };
+    };
+    return p;
+};
+
+inline std::atomic<std::shared_ptr<const GemmProfile>>& _gemm_profile_slot()
+{
+    static std::atomic<std::shared_ptr<const GemmProfile>> slot(
+        std::make_shared<const GemmProfile>(_startup_gemm_profile()));
+    return slot;
+};
+
+}; // namespace detail
+
+// The active profile, loaded from gemm_profile_path() on first use.
+inline std::shared_ptr<const GemmProfile> gemm_profile()
+{
+    return detail::_gemm_profile_slot().load(std::memory_order_acquire);
+};
+
+inline void set_gemm_profile(GemmProfile p)
+{
+    detail::_gemm_profile_slot().store(std::make_shared<const GemmProfile>(std::move(p)), std::memory_order_release);
+};
+
+inline bool tune_gemm_profile(const std::string& path, const GemmTuneOptions& opts)
+{
+    GemmProfile p;
+    tune_gemm<float>(p, opts);
+    tune_gemm<double>(p, opts);
+
+    bool saved = false;
+    if (!path.empty())
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+        saved = p.save(path);
+    };
+
+    set_gemm_profile(std::move(p));
+    return saved;
+};
+
+// Blocking for an m x n x k product: the nearest tuned shape bucket of the
+// active profile, or the built-in default.
+template <typename TN>
+GemmConfig gemm_config(std::size_t m, std::size_t n, std::size_t k)
+{
+    constexpr std::string_view key = gemm_type_key<TN>();
+    if constexpr (key.empty())
+        return GemmConfig{};
+    else
+        return gemm_profile()->lookup(key, m, n, k);
+};
+
+// C = alpha * A * B + beta * C on strided storage (element (i, j) of X at
+// X[i * rsX + j * csX]), blocked per the active profile.
+template <typename TN>
+void gemm(
+    std::size_t m, std::size_t n, std::size_t k,
+    TN alpha,
+    const TN* a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+    const TN* b, std::ptrdiff_t rsb, std::ptrdiff_t csb,
+    TN beta,
+    TN* c, std::ptrdiff_t rsc, std::ptrdiff_t csc)
+{
+    gemm_with<TN>(gemm_config<TN>(m, n, k), m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc, csc);
+};
+
+}; // namespace seoncore::ops
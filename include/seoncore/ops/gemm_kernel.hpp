@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <seoncore/ops/gemm_profile.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::ops
+{
+
+// Operand read through explicit row and column strides, so row-major,
+// column-major and transposed storage all pack the same way.
+template <typename TN>
+struct StridedOperand
+{
+    const TN*       data;
+    std::ptrdiff_t  rs;
+    std::ptrdiff_t  cs;
+
+    constexpr TN operator()(std::size_t i, std::size_t j) const noexcept
+    {
+        return data[static_cast<std::ptrdiff_t>(i) * rs + static_cast<std::ptrdiff_t>(j) * cs];
+    };
+};
+
+namespace kernels
+{
+
+// MR x NR block of C += A_panel * B_panel over kc, with both panels packed
+// k-major (MR and NR contiguous values per k). The accumulator is a fixed
+// size local array so the compiler keeps it in registers and vectorizes
+// along NR.
+template <typename TN, std::size_t MR, std::size_t NR>
+inline void gemm_micro(std::size_t kc, const TN* a, const TN* b, TN* acc) noexcept
+{
+    TN c[MR * NR] = {};
+
+    for (std::size_t p = 0; p < kc; ++p)
+    {
+        const TN* ap = a + p * MR;
+        const TN* bp = b + p * NR;
+        for (std::size_t i = 0; i < MR; ++i)
+        {
+            const TN ai = ap[i];
+            for (std::size_t j = 0; j < NR; ++j)
+                c[i * NR + j] += ai * bp[j];
+        };
+    };
+
+    for (std::size_t t = 0; t < MR * NR; ++t)
+        acc[t] = c[t];
+};
+
+// Stands in for an epilogue when the product is stored as is.
+struct no_epilogue {};
+
+// C(0:mr, 0:nr) = alpha * acc + beta * C. beta == 0 overwrites C without
+// reading it. With an epilogue (non-null only on the last k block) each
+// value also goes through epi->finish(i0 + i, j0 + j, v) before the store.
+template <typename TN, std::size_t NR, class Epi>
+inline void gemm_store(
+    const TN* acc, std::size_t mr, std::size_t nr,
+    TN alpha, TN beta,
+    TN* c, std::ptrdiff_t rsc, std::ptrdiff_t csc,
+    const Epi* epi, std::size_t i0, std::size_t j0)
+{
+    for (std::size_t i = 0; i < mr; ++i)
+    {
+        TN* ci = c + static_cast<std::ptrdiff_t>(i) * rsc;
+        for (std::size_t j = 0; j < nr; ++j)
+        {
+            TN& cij = ci[static_cast<std::ptrdiff_t>(j) * csc];
+            TN v = alpha * acc[i * NR + j];
+            if (beta != TN{0}) v += beta * cij;
+
+            if constexpr (!std::is_same_v<Epi, no_epilogue>)
+                if (epi) v = epi->finish(i0 + i, j0 + j, v);
+
+            cij = v;
+        };
+    };
+};
+
+// Packs rows [i0, i0 + mc) x k-range [p0, p0 + kc) of a into MR-row
+// panels, zero-padding the last one.
+template <typename TN, std::size_t MR, class AOp>
+inline void gemm_pack_a(const AOp& a, std::size_t i0, std::size_t mc, std::size_t p0, std::size_t kc, TN* out) noexcept
+{
+    for (std::size_t ir = 0; ir < mc; ir += MR)
+    {
+        const std::size_t mr = std::min(MR, mc - ir);
+        TN* panel = out + ir * kc;
+        for (std::size_t p = 0; p < kc; ++p)
+            for (std::size_t i = 0; i < MR; ++i)
+                panel[p * MR + i] = (i < mr) ? a(i0 + ir + i, p0 + p) : TN{0};
+    };
+};
+
+// Packs k-range [p0, p0 + kc) x columns [j0 + jr_lo, j0 + jr_hi) of b into
+// NR-column panels; jr_lo is a multiple of NR.
+template <typename TN, std::size_t NR, class BOp>
+inline void gemm_pack_b(
+    const BOp& b, std::size_t p0, std::size_t kc,
+    std::size_t j0, std::size_t nc, std::size_t jr_lo, std::size_t jr_hi, TN* out) noexcept
+{
+    for (std::size_t jr = jr_lo; jr < jr_hi; jr += NR)
+    {
+        const std::size_t nr = std::min(NR, nc - jr);
+        TN* panel = out + jr * kc;
+        for (std::size_t p = 0; p < kc; ++p)
+            for (std::size_t j = 0; j < NR; ++j)
+                panel[p * NR + j] = (j < nr) ? b(p0 + p, j0 + jr + j) : TN{0};
+    };
+};
+
+template <typename TN>
+inline std::vector<TN>& gemm_buffer_a()
+{
+    thread_local std::vector<TN> buf;
+    return buf;
+};
+
+template <typename TN>
+inline std::vector<TN>& gemm_buffer_b()
+{
+    thread_local std::vector<TN> buf;
+    return buf;
+};
+
+inline constexpr std::size_t _round_up(std::size_t x, std::size_t m) noexcept
+{
+    return (x + m - 1) / m * m;
+};
+
+// Five-loop blocked GEMM (Goto / BLIS order: jc, pc, ic, jr, ir):
+// C = alpha * a * b + beta * C over an m x n x k problem, with `epi`
+// applied as the last k block is stored. Packing buffers are per-thread
+// and reused across calls.
+template <typename TN, std::size_t MR, std::size_t NR, class AOp, class BOp, class Epi>
+void gemm_blocked(
+    std::size_t m, std::size_t n, std::size_t k,
+    TN alpha, const AOp& a, const BOp& b,
+    TN beta, TN* c, std::ptrdiff_t rsc, std::ptrdiff_t csc,
+    const GemmConfig& cfg, const Epi* epi)
+{
+    using seoncore::parallel::default_pool;
+
+    const std::size_t mc_max = _round_up(std::max<std::size_t>(cfg.mc, MR), MR);
+    const std::size_t nc_max = _round_up(std::max<std::size_t>(cfg.nc, NR), NR);
+    const std::size_t kc_max = std::max<std::size_t>(cfg.kc, 1);
+
+    const std::size_t pool_threads = default_pool().concurrency();
+    const std::size_t threads = (cfg.threads == 0) ? pool_threads : std::min(cfg.threads, pool_threads);
+
+    auto grain = [threads](std::size_t units) { return (units + threads - 1) / threads; };
+
+    std::vector<TN>& bbuf = gemm_buffer_b<TN>();
+    bbuf.resize(std::max(bbuf.size(), kc_max * std::min(nc_max, _round_up(n, NR))));
+
+    for (std::size_t jc = 0; jc < n; jc += nc_max)
+    {
+        const std::size_t nc = std::min(nc_max, n - jc);
+        const std::size_t n_panels = (nc + NR - 1) / NR;
+
+        for (std::size_t pc = 0; pc < k; pc += kc_max)
+        {
+            const std::size_t kc = std::min(kc_max, k - pc);
+            const TN beta_pc = (pc == 0) ? beta : TN{1};
+            const Epi* epi_pc = (pc + kc == k) ? epi : nullptr;
+            TN* bpack = bbuf.data();
+
+            default_pool().parallel_for(n_panels, grain(n_panels), [&](std::size_t lo, std::size_t hi)
+            {
+                gemm_pack_b<TN, NR>(b, pc, kc, jc, nc, lo * NR, std::min(hi * NR, nc), bpack);
+            });
+
+            const std::size_t m_blocks = (m + mc_max - 1) / mc_max;
+            GemmSplit split = cfg.split;
+            if (split == GemmSplit::Auto)
+                split = (m_blocks >= threads || n_panels < 2 * threads) ? GemmSplit::M : GemmSplit::N;
+
+            auto macro = [&](const TN* apack, std::size_t ic, std::size_t mc, std::size_t jr_lo, std::size_t jr_hi)
+            {
+                TN acc[MR * NR];
+                for (std::size_t jr = jr_lo; jr < jr_hi; jr += NR)
+                {
+                    const std::size_t nr = std::min(NR, nc - jr);
+                    for (std::size_t ir = 0; ir < mc; ir += MR)
+                    {
+                        const std::size_t mr = std::min(MR, mc - ir);
+                        gemm_micro<TN, MR, NR>(kc, apack + ir * kc, bpack + jr * kc, acc);
+
+                        TN* cij = c + static_cast<std::ptrdiff_t>(ic + ir) * rsc
+                                    + static_cast<std::ptrdiff_t>(jc + jr) * csc;
+                        gemm_store<TN, NR>(acc, mr, nr, alpha, beta_pc, cij, rsc, csc,
+                                           epi_pc, ic + ir, jc + jr);
+                    };
+                };
+            };
+
+            if (split == GemmSplit::M)
+            {
+                // Row blocks of C follow the node partition of
+                // parallel_for_local, which is also how NumaStorage
+                // first-touches a row-major C.
+                default_pool().parallel_for_local(m_blocks, grain(m_blocks), [&](std::size_t lo, std::size_t hi)
+                {
+                    std::vector<TN>& abuf = gemm_buffer_a<TN>();
+                    abuf.resize(std::max(abuf.size(), mc_max * kc_max));
+
+                    for (std::size_t blk = lo; blk < hi; ++blk)
+                    {
+                        const std::size_t ic = blk * mc_max;
+                        const std::size_t mc = std::min(mc_max, m - ic);
+                        gemm_pack_a<TN, MR>(a, ic, mc, pc, kc, abuf.data());
+                        macro(abuf.data(), ic, mc, 0, nc);
+                    };
+                });
+            }
+            else
+            {
+                std::vector<TN>& abuf = gemm_buffer_a<TN>();
+                abuf.resize(std::max(abuf.size(), mc_max * kc_max));
+
+                for (std::size_t ic = 0; ic < m; ic += mc_max)
+                {
+                    const std::size_t mc = std::min(mc_max, m - ic);
+                    gemm_pack_a<TN, MR>(a, ic, mc, pc, kc, abuf.data());
+
+                    const TN* apack = abuf.data();
+                    default_pool().parallel_for(n_panels, grain(n_panels), [&](std::size_t lo, std::size_t hi)
+                    {
+                        macro(apack, ic, mc, lo * NR, std::min(hi * NR, nc));
+                    });
+                };
+            };
+        };
+    };
+};
+
+}; // namespace kernels
+
+// C = alpha * a * b + beta * C with a: m x k and b: k x n read through
+// operand functors (a(i, p), b(p, j)) and C addressed by strides, using
+// the blocking and micro-kernel of `cfg`. A non-null `epi` is applied to
+// every output element as it is stored (see GemmEpilogue).
+template <typename TN, class AOp, class BOp, class Epi = kernels::no_epilogue>
+void gemm_with(
+    const GemmConfig& cfg,
+    std::size_t m, std::size_t n, std::size_t k,
+    TN alpha, const AOp& a, const BOp& b,
+    TN beta, TN* c, std::ptrdiff_t rsc, std::ptrdiff_t csc,
+    const Epi* epi = nullptr)
+{
+    if (m == 0 || n == 0) return;
+
+    if (k == 0)
+    {
+        for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                TN& cij = c[static_cast<std::ptrdiff_t>(i) * rsc + static_cast<std::ptrdiff_t>(j) * csc];
+                TN v = (beta == TN{0}) ? TN{0} : beta * cij;
+                if constexpr (!std::is_same_v<Epi, kernels::no_epilogue>)
+                    if (epi) v = epi->finish(i, j, v);
+                cij = v;
+            };
+        return;
+    };
+
+    switch (cfg.kernel)
+    {
+        case GemmKernel::Tile4x4:
+            kernels::gemm_blocked<TN, 4, 4>(m, n, k, alpha, a, b, beta, c, rsc, csc, cfg, epi);
+            break;
+        case GemmKernel::Tile4x8:
+            kernels::gemm_blocked<TN, 4, 8>(m, n, k, alpha, a, b, beta, c, rsc, csc, cfg, epi);
+            break;
+        case GemmKernel::Tile8x4:
+            kernels::gemm_blocked<TN, 8, 4>(m, n, k, alpha, a, b, beta, c, rsc, csc, cfg, epi);
+            break;
+        case GemmKernel::Tile8x8:
+            kernels::gemm_blocked<TN, 8, 8>(m, n, k, alpha, a, b, beta, c, rsc, csc, cfg, epi);
+            break;
+        case GemmKernel::Tile6x16:
+            kernels::gemm_blocked<TN, 6, 16>(m, n, k, alpha, a, b, beta, c, rsc, csc, cfg, epi);
+            break;
+    };
+};
+
+// Strided overload: element (i, j) of X lives at X[i * rsX + j * csX].
+template <typename TN>
+void gemm_with(
+    const GemmConfig& cfg,
+    std::size_t m, std::size_t n, std::size_t k,
+    TN alpha,
+    const TN* a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+    const TN* b, std::ptrdiff_t rsb, std::ptrdiff_t csb,
+    TN beta,
+    TN* c, std::ptrdiff_t rsc, std::ptrdiff_t csc)
+{
+    gemm_with<TN>(cfg, m, n, k,
+                  alpha, StridedOperand<TN>{ a, rsa, csa }, StridedOperand<TN>{ b, rsb, csb },
+                  beta, c, rsc, csc);
+};
+
+}; // namespace seoncore::ops
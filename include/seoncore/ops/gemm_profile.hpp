@@ -0,0 +1,242 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace seoncore::ops
+{
+
+// Register tile computed by the GEMM micro-kernel, MR x NR.
+enum class GemmKernel
+{
+    Tile4x4,
+    Tile4x8,
+    Tile8x4,
+    Tile8x8,
+    Tile6x16
+};
+
+// Which loop the thread pool splits: row blocks of A (each thread packs
+// its own A block) or column panels of B (one shared A block per step).
+enum class GemmSplit
+{
+    Auto,
+    M,
+    N
+};
+
+// Blocking of the five-loop GEMM: mc x kc blocks of A and kc x nc panels
+// of B are packed, `threads` bounds the number of parallel chunks (0 means
+// the whole pool).
+struct GemmConfig
+{
+    GemmKernel      kernel  = GemmKernel::Tile4x8;
+    std::size_t     mc      = 128;
+    std::size_t     kc      = 256;
+    std::size_t     nc      = 4096;
+    std::size_t     threads = 0;
+    GemmSplit       split   = GemmSplit::Auto;
+
+    constexpr bool operator==(const GemmConfig&) const noexcept = default;
+};
+
+// Key for the element types the profile tracks; empty for the rest, which
+// always run with the default config.
+template <typename TN>
+constexpr std::string_view gemm_type_key() noexcept
+{
+    if constexpr (std::is_same_v<TN, float>)        return "f32";
+    else if constexpr (std::is_same_v<TN, double>)  return "f64";
+    else                                            return "";
+};
+
+inline constexpr std::string_view gemm_kernel_name(GemmKernel k) noexcept
+{
+    switch (k)
+    {
+        case GemmKernel::Tile4x4:  return "4x4";
+        case GemmKernel::Tile4x8:  return "4x8";
+        case GemmKernel::Tile8x4:  return "8x4";
+        case GemmKernel::Tile8x8:  return "8x8";
+        case GemmKernel::Tile6x16: return "6x16";
+    };
+    return "4x8";
+};
+
+inline constexpr bool parse_gemm_kernel(std::string_view s, GemmKernel& out) noexcept
+{
+    for (GemmKernel k : { GemmKernel::Tile4x4, GemmKernel::Tile4x8, GemmKernel::Tile8x4,
+                          GemmKernel::Tile8x8, GemmKernel::Tile6x16 })
+        if (gemm_kernel_name(k) == s)
+        {
+            out = k;
+            return true;
+        };
+    return false;
+};
+
+inline constexpr std::string_view gemm_split_name(GemmSplit s) noexcept
+{
+    switch (s)
+    {
+        case GemmSplit::Auto: return "auto";
+        case GemmSplit::M:    return "m";
+        case GemmSplit::N:    return "n";
+    };
+    return "auto";
+};
+
+inline constexpr bool parse_gemm_split(std::string_view s, GemmSplit& out) noexcept
+{
+    for (GemmSplit v : { GemmSplit::Auto, GemmSplit::M, GemmSplit::N })
+        if (gemm_split_name(v) == s)
+        {
+            out = v;
+            return true;
+        };
+    return false;
+};
+
+// Shape bucket of one GEMM dimension: ceil(log2(x)), so 65..128 share a
+// bucket.
+inline constexpr std::uint32_t gemm_bucket(std::size_t x) noexcept
+{
+    return (x <= 1) ? 0u : static_cast<std::uint32_t>(std::bit_width(x - 1));
+};
+
+// Tuned configs per (element type, shape bucket), as written by the tuner.
+// Text format, one entry per line, '#' starts a comment:
+//
+//   <type> <bm> <bn> <bk> <kernel> <mc> <kc> <nc> <threads> <split>
+//
+// e.g. "f64 8 8 8 4x8 128 256 4096 0 auto".
+class GemmProfile
+{
+public:
+    struct Entry
+    {
+        std::string     type;
+        std::uint32_t   bm;
+        std::uint32_t   bn;
+        std::uint32_t   bk;
+        GemmConfig      config;
+    };
+
+    bool empty() const noexcept { return _entries.empty(); };
+    const std::vector<Entry>& entries() const noexcept { return _entries; };
+
+    // Adds or replaces the entry of the bucket holding (m, n, k).
+    void set(std::string_view type, std::size_t m, std::size_t n, std::size_t k, const GemmConfig& cfg)
+    {
+        set_bucket(type, gemm_bucket(m), gemm_bucket(n), gemm_bucket(k), cfg);
+    };
+
+    void set_bucket(std::string_view type, std::uint32_t bm, std::uint32_t bn, std::uint32_t bk, const GemmConfig& cfg)
+    {
+        for (auto& e : _entries)
+            if (e.type == type && e.bm == bm && e.bn == bn && e.bk == bk)
+            {
+                e.config = cfg;
+                return;
+            };
+        _entries.push_back({ std::string(type), bm, bn, bk, cfg });
+    };
+
+    // Config of the nearest tuned bucket for this type (L1 distance in
+    // bucket space, so one step is a factor of two in one dimension), or
+    // `fallback` when the type has no entries.
+    GemmConfig lookup(std::string_view type, std::size_t m, std::size_t n, std::size_t k,
+                      const GemmConfig& fallback = {}) const noexcept
+    {
+        const std::uint32_t bm = gemm_bucket(m);
+        const std::uint32_t bn = gemm_bucket(n);
+        const std::uint32_t bk = gemm_bucket(k);
+
+        const Entry* best = nullptr;
+        std::uint32_t best_d = ~0u;
+        for (const auto& e : _entries)
+        {
+            if (e.type != type) continue;
+
+            const std::uint32_t d = _dist(e.bm, bm) + _dist(e.bn, bn) + _dist(e.bk, bk);
+            if (d < best_d)
+            {
+                best = &e;
+                best_d = d;
+                if (d == 0) break;
+            };
+        };
+        return best ? best->config : fallback;
+    };
+
+    void write(std::ostream& os) const
+    {
+        os << "# seoncore gemm profile v1\n"
+           << "# type bm bn bk kernel mc kc nc threads split\n";
+        for (const auto& e : _entries)
+            os << e.type << ' ' << e.bm << ' ' << e.bn << ' ' << e.bk << ' '
+               << gemm_kernel_name(e.config.kernel) << ' '
+               << e.config.mc << ' ' << e.config.kc << ' ' << e.config.nc << ' '
+               << e.config.threads << ' ' << gemm_split_name(e.config.split) << '\n';
+    };
+
+    // Lines that do not parse are skipped, so a damaged or newer profile
+    // degrades to defaults instead of failing.
+    static GemmProfile read(std::istream& is)
+    {
+        GemmProfile p;
+        std::string line;
+        while (std::getline(is, line))
+        {
+            if (line.empty() || line[0] == '#') continue;
+
+            std::istringstream ls(line);
+            Entry e;
+            std::string kernel, split;
+            if (!(ls >> e.type >> e.bm >> e.bn >> e.bk >> kernel
+                     >> e.config.mc >> e.config.kc >> e.config.nc >> e.config.threads >> split))
+                continue;
+            if (!parse_gemm_kernel(kernel, e.config.kernel)) continue;
+            if (!parse_gemm_split(split, e.config.split)) continue;
+            if (e.config.mc == 0 || e.config.kc == 0 || e.config.nc == 0) continue;
+
+            p.set_bucket(e.type, e.bm, e.bn, e.bk, e.config);
+        };
+        return p;
+    };
+
+    static GemmProfile load(const std::string& path)
+    {
+        std::ifstream in(path);
+        if (!in) return {};
+        return read(in);
+    };
+
+    bool save(const std::string& path) const
+    {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out) return false;
+        write(out);
+        return static_cast<bool>(out);
+    };
+
+private:
+    std::vector<Entry>  _entries;
+
+    static constexpr std::uint32_t _dist(std::uint32_t a, std::uint32_t b) noexcept
+    {
+        return (a > b) ? a - b : b - a;
+    };
+
+}; // class GemmProfile
+
+}; // namespace seoncore::ops
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include <seoncore/ops/gemm_profile.hpp>
+#include <seoncore/ops/gemm_kernel.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::ops
+{
+
+struct GemmTuneOptions
+{
+    // Representative (m, n, k) shapes; each gets its own profile entry.
+    std::vector<std::array<std::size_t, 3>> shapes = {
+        { 64, 64, 64 },
+        { 256, 256, 256 },
+        { 1024, 1024, 1024 },
+        { 4096, 64, 1024 },
+        { 64, 4096, 1024 },
+    };
+
+    // Each candidate is timed as the best of `repeats` runs, every run
+    // lasting at least `min_seconds`.
+    std::size_t repeats     = 3;
+    double      min_seconds = 0.02;
+};
+
+namespace detail
+{
+
+template <typename TN>
+struct _gemm_bench
+{
+    std::size_t     m, n, k;
+    std::vector<TN> a, b, c;
+    std::size_t     repeats;
+    double          min_seconds;
+
+    _gemm_bench(std::size_t m_, std::size_t n_, std::size_t k_, const GemmTuneOptions& opts)
+        : m(m_), n(n_), k(k_), a(m_ * k_), b(k_ * n_), c(m_ * n_)
+        , repeats(std::max<std::size_t>(1, opts.repeats)), min_seconds(opts.min_seconds)
+    {
+        std::mt19937 gen(0x5e0c);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        for (auto& x : a) x = static_cast<TN>(u(gen));
+        for (auto& x : b) x = static_cast<TN>(u(gen));
+    };
+
+    // Seconds per call, best of `repeats`.
+    double time(const GemmConfig& cfg)
+    {
+        using clock = std::chrono::steady_clock;
+
+        auto run = [&]
+        {
+            gemm_with<TN>(cfg, m, n, k,
+                          TN{1}, a.data(), std::ptrdiff_t(k), 1, b.data(), std::ptrdiff_t(n), 1,
+                          TN{0}, c.data(), std::ptrdiff_t(n), 1);
+        };
+
+        run();  // warm caches and packing buffers
+
+        double best = std::numeric_limits<double>::infinity();
+        for (std::size_t r = 0; r < repeats; ++r)
+        {
+            std::size_t calls = 0;
+            const auto t0 = clock::now();
+            double elapsed = 0.0;
+            do
+            {
+                run();
+                ++calls;
+                elapsed = std::chrono::duration<double>(clock::now() - t0).count();
+            }
+            while (elapsed < min_seconds);
+
+            best = std::min(best, elapsed / static_cast<double>(calls));
+        };
+        return best;
+    };
+};
+
+// Tries each value of one parameter with the others fixed and keeps the
+// fastest.
+template <typename TN, class T, class Set>
+void _tune_axis(_gemm_bench<TN>& bench, GemmConfig& best, double& best_t, const std::vector<T>& values, Set set)
+{
+    for (const T& v : values)
+    {
+        GemmConfig cand = best;
+        set(cand, v);
+        if (cand == best) continue;
+
+        const double t = bench.time(cand);
+        if (t < best_t)
+        {
+            best_t = t;
+            best = cand;
+        };
+    };
+};
+
+}; // namespace detail
+
+// Best config for one shape on this host, by coordinate descent: kernel,
+// then kc, mc, nc, and finally the thread split.
+template <typename TN>
+GemmConfig tune_gemm_shape(std::size_t m, std::size_t n, std::size_t k, const GemmTuneOptions& opts = {})
+{
+    detail::_gemm_bench<TN> bench(m, n, k, opts);
+
+    GemmConfig best;
+    double best_t = bench.time(best);
+
+    detail::_tune_axis<TN>(bench, best, best_t,
+        std::vector<GemmKernel>{ GemmKernel::Tile4x4, GemmKernel::Tile4x8, GemmKernel::Tile8x4,
+                                 GemmKernel::Tile8x8, GemmKernel::Tile6x16 },
+        [](GemmConfig& c, GemmKernel v) { c.kernel = v; });
+
+    detail::_tune_axis<TN>(bench, best, best_t,
+        std::vector<std::size_t>{ 64, 128, 256, 384, 512 },
+        [](GemmConfig& c, std::size_t v) { c.kc = v; });
+
+    detail::_tune_axis<TN>(bench, best, best_t,
+        std::vector<std::size_t>{ 32, 64, 96, 128, 192, 256, 512 },
+        [](GemmConfig& c, std::size_t v) { c.mc = v; });
+
+    detail::_tune_axis<TN>(bench, best, best_t,
+        std::vector<std::size_t>{ 256, 1024, 4096, 16384 },
+        [](GemmConfig& c, std::size_t v) { c.nc = v; });
+
+    const std::size_t hw = seoncore::parallel::default_pool().concurrency();
+    std::vector<std::size_t> thread_counts{ 0 };
+    for (std::size_t t = 1; t < hw; t *= 2) thread_counts.push_back(t);
+
+    detail::_tune_axis<TN>(bench, best, best_t, thread_counts,
+        [](GemmConfig& c, std::size_t v) { c.threads = v; });
+
+    detail::_tune_axis<TN>(bench, best, best_t,
+        std::vector<GemmSplit>{ GemmSplit::Auto, GemmSplit::M, GemmSplit::N },
+        [](GemmConfig& c, GemmSplit v) { c.split = v; });
+
+    return best;
+};
+
+// Tunes every shape of `opts` for TN and records the winners in `profile`.
+template <typename TN>
+void tune_gemm(GemmProfile& profile, const GemmTuneOptions& opts = {})
+{
+    static_assert(!gemm_type_key<TN>().empty(), "tune_gemm: no profile key for this element type");
+
+    for (const auto& [m, n, k] : opts.shapes)
+        profile.set(gemm_type_key<TN>(), m, n, k, tune_gemm_shape<TN>(m, n, k, opts));
+};
+
+}; // namespace seoncore::ops
@@ -4,6 +4,9 @@
 #include <seoncore/matrix/dense_fwd.hpp>
 #include <seoncore/concepts/matrix_like.hpp>
 #include <seoncore/ops/tag_invoke.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/ops/epilogue.hpp>
 #include <cassert>
 #include <cstddef>
 #include <utility>
@@ -13,12 +16,12 @@ namespace seoncore::tags
 {
 struct matmul_t
 {
-    template <class A, class B>
-    constexpr auto operator()(A&& a, B&& b) const
-        noexcept(noexcept(tag_invoke(*this, std::forward<A>(a), std::forward<B>(b))))
-        -> decltype(tag_invoke(*this, std::forward<A>(a), std::forward<B>(b)))
+    template <class A, class B, class... Rest>
+    constexpr auto operator()(A&& a, B&& b, Rest&&... rest) const
+        noexcept(noexcept(tag_invoke(*this, std::forward<A>(a), std::forward<B>(b), std::forward<Rest>(rest)...)))
+        -> decltype(tag_invoke(*this, std::forward<A>(a), std::forward<B>(b), std::forward<Rest>(rest)...))
     {
-        return tag_invoke(*this, std::forward<A>(a), std::forward<B>(b));
+        return tag_invoke(*this, std::forward<A>(a), std::forward<B>(b), std::forward<Rest>(rest)...);
     }
 };
 
@@ -29,11 +32,13 @@ inline constexpr matmul_t matmul{};
 namespace seoncore::ops
 {
 
-template <class A, class B>
+// Extra arguments cover the fused forms: (a, b, epilogue) and
+// (a, b, c, epilogue) for matmul_into.
+template <class A, class B, class... Rest>
 concept has_tagged_matmul =
-requires(A&& a, B&& b)
+requires(A&& a, B&& b, Rest&&... rest)
 {
-    tag_invoke(seoncore::tags::matmul, std::forward<A>(a), std::forward<B>(b));
+    tag_invoke(seoncore::tags::matmul, std::forward<A>(a), std::forward<B>(b), std::forward<Rest>(rest)...);
 };
 
 template <seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike B>
@@ -62,14 +67,89 @@ constexpr auto matmul_fallback(const A& a, const B& b)
 template <seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike B>
 constexpr auto matmul(const A& a, const B& b)
 {
+    using value_type = std::remove_cvref_t<decltype(a(0,0) * b(0,0))>;
+
+    [[maybe_unused]] const std::size_t m = a.rows();
+    [[maybe_unused]] const std::size_t n = b.cols();
+    [[maybe_unused]] const std::size_t k = a.cols();
+    [[maybe_unused]] const double bytes = static_cast<double>(m * k + k * n + m * n) * sizeof(value_type);
+
     if constexpr (has_tagged_matmul<const A&, const B&>)
     {
+        SEONCORE_OP_SCOPE("matmul", seoncore::enums::Path::Tagged, m, n, k, 2.0 * m * n * k, bytes);
         return tag_invoke(seoncore::tags::matmul, a, b);
     }
     else
     {
+        SEONCORE_OP_SCOPE("matmul", seoncore::enums::Path::Fallback, m, n, k, 2.0 * m * n * k, bytes);
         return matmul_fallback(a, b);
     };
 };
 
+// C = epi(A * B): alpha scaling, biases and the elementwise functor are
+// fused into the product where an overload supports it, otherwise applied
+// in one pass over the result. C starts from zero, so epi.beta is unused.
+template <seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike B, GemmEpilogueLike E>
+constexpr auto matmul(const A& a, const B& b, const E& epi)
+{
+    using value_type = std::remove_cvref_t<decltype(a(0,0) * b(0,0))>;
+
+    [[maybe_unused]] const std::size_t m = a.rows();
+    [[maybe_unused]] const std::size_t n = b.cols();
+    [[maybe_unused]] const std::size_t k = a.cols();
+    [[maybe_unused]] const double bytes = static_cast<double>(m * k + k * n + m * n) * sizeof(value_type);
+
+    if constexpr (has_tagged_matmul<const A&, const B&, const E&>)
+    {
+        SEONCORE_OP_SCOPE("matmul_fused", seoncore::enums::Path::Tagged, m, n, k, 2.0 * m * n * k, bytes);
+        return tag_invoke(seoncore::tags::matmul, a, b, epi);
+    }
+    else
+    {
+        SEONCORE_OP_SCOPE("matmul_fused", seoncore::enums::Path::Fallback, m, n, k, 2.0 * m * n * k, bytes);
+
+        auto c = matmul(a, b);
+        for (std::size_t i = 0; i < c.rows(); ++i)
+            for (std::size_t j = 0; j < c.cols(); ++j)
+                c(i, j) = epi.finish(i, j, epi.alpha * c(i, j));
+        return c;
+    };
+};
+
+// C = epi(alpha * A * B + beta * C), in place. C must already be
+// a.rows() x b.cols().
+template <seoncore::concepts::MatrixLike A, seoncore::concepts::MatrixLike B,
+          seoncore::concepts::MatrixLike C, GemmEpilogueLike E>
+constexpr void matmul_into(const A& a, const B& b, C& c, const E& epi)
+{
+    assert(a.cols() == b.rows());
+    assert(c.rows() == a.rows() && c.cols() == b.cols());
+
+    using value_type = typename C::value_type;
+
+    [[maybe_unused]] const std::size_t m = a.rows();
+    [[maybe_unused]] const std::size_t n = b.cols();
+    [[maybe_unused]] const std::size_t k = a.cols();
+    [[maybe_unused]] const double bytes = static_cast<double>(m * k + k * n + 2 * m * n) * sizeof(value_type);
+
+    if constexpr (has_tagged_matmul<const A&, const B&, C&, const E&>)
+    {
+        SEONCORE_OP_SCOPE("matmul_fused", seoncore::enums::Path::Tagged, m, n, k, 2.0 * m * n * k, bytes);
+        tag_invoke(seoncore::tags::matmul, a, b, c, epi);
+    }
+    else
+    {
+        SEONCORE_OP_SCOPE("matmul_fused", seoncore::enums::Path::Fallback, m, n, k, 2.0 * m * n * k, bytes);
+
+        const auto p = matmul(a, b);
+        for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                value_type v = epi.alpha * p(i, j);
+                if (epi.beta != value_type{0}) v += epi.beta * c(i, j);
+                c(i, j) = epi.finish(i, j, v);
+            };
+    };
+};
+
 }; // namespace seoncore::ops
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace seoncore::ops::kernels
+{
+
+// Codes are kept in [-127, 127], so |a| fits u8 and the u8 * s8 pair sums of
+// `pmaddubsw` never saturate (2 * 127 * 127 < INT16_MAX).
+
+// Products summed in int32 before the partial is widened to int64:
+// 2^16 * 127 * 127 < INT32_MAX, so no k overflows the accumulators.
+inline constexpr std::size_t qdot_block = std::size_t{1} << 16;
+
+#if defined(__AVX2__)
+
+inline std::int32_t _hsum_epi32(__m256i v) noexcept
+{
+    __m128i lo = _mm256_castsi256_si128(v);
+    __m128i hi = _mm256_extracti128_si256(v, 1);
+    __m128i s  = _mm_add_epi32(lo, hi);
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(s);
+};
+
+inline __m256i _dp_u8s8(__m256i acc, __m256i ua, __m256i sb) noexcept
+{
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    return _mm256_dpbusd_epi32(acc, ua, sb);
+#elif defined(__AVXVNNI__)
+    return _mm256_dpbusd_avx_epi32(acc, ua, sb);
+#else
+    const __m256i pairs = _mm256_maddubs_epi16(ua, sb);
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(pairs, _mm256_set1_epi16(1)));
+#endif
+};
+
+#endif
+
+// Dot products of one int8 row of A against four int8 columns of B, all of
+// length `k` <= qdot_block and contiguous.
+inline void _dot_i8x4_block(
+        const std::int8_t* a,
+        const std::int8_t* b0,
+        const std::int8_t* b1,
+        const std::int8_t* b2,
+        const std::int8_t* b3,
+        std::size_t k,
+        std::int32_t* out) noexcept
+{
+    std::size_t p = 0;
+    std::int32_t r0 = 0, r1 = 0, r2 = 0, r3 = 0;
+
+#if defined(__AVX2__)
+    __m256i c0 = _mm256_setzero_si256();
+    __m256i c1 = _mm256_setzero_si256();
+    __m256i c2 = _mm256_setzero_si256();
+    __m256i c3 = _mm256_setzero_si256();
+
+    for (; p + 32 <= k; p += 32)
+    {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + p));
+        const __m256i ua = _mm256_abs_epi8(va);
+
+        c0 = _dp_u8s8(c0, ua, _mm256_sign_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b0 + p)), va));
+        c1 = _dp_u8s8(c1, ua, _mm256_sign_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b1 + p)), va));
+        c2 = _dp_u8s8(c2, ua, _mm256_sign_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b2 + p)), va));
+        c3 = _dp_u8s8(c3, ua, _mm256_sign_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b3 + p)), va));
+    };
+
+    r0 = _hsum_epi32(c0);
+    r1 = _hsum_epi32(c1);
+    r2 = _hsum_epi32(c2);
+    r3 = _hsum_epi32(c3);
+#endif
+
+    for (; p < k; ++p)
+    {
+        const std::int32_t ap = a[p];
+        r0 += ap * b0[p];
+        r1 += ap * b1[p];
+        r2 += ap * b2[p];
+        r3 += ap * b3[p];
+    };
+
+    out[0] = r0;
+    out[1] = r1;
+    out[2] = r2;
+    out[3] = r3;
+};
+
+inline std::int32_t _dot_i8_block(const std::int8_t* a, const std::int8_t* b, std::size_t k) noexcept
+{
+    std::size_t p = 0;
+    std::int32_t r = 0;
+
+#if defined(__AVX2__)
+    __m256i c = _mm256_setzero_si256();
+
+    for (; p + 32 <= k; p += 32)
+    {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + p));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + p));
+        c = _dp_u8s8(c, _mm256_abs_epi8(va), _mm256_sign_epi8(vb, va));
+    };
+
+    r = _hsum_epi32(c);
+#endif
+
+    for (; p < k; ++p)
+        r += static_cast<std::int32_t>(a[p]) * b[p];
+
+    return r;
+};
+
+// Dot products of any length, in int32 blocks of qdot_block widened to int64.
+inline void dot_i8x4(
+        const std::int8_t* a,
+        const std::int8_t* b0,
+        const std::int8_t* b1,
+        const std::int8_t* b2,
+        const std::int8_t* b3,
+        std::size_t k,
+        std::int64_t* out) noexcept
+{
+    out[0] = out[1] = out[2] = out[3] = 0;
+
+    for (std::size_t p = 0; p < k; p += qdot_block)
+    {
+        const std::size_t len = (k - p < qdot_block) ? k - p : qdot_block;
+
+        std::int32_t part[4];
+        _dot_i8x4_block(a + p, b0 + p, b1 + p, b2 + p, b3 + p, len, part);
+        for (std::size_t t = 0; t < 4; ++t)
+            out[t] += part[t];
+    };
+};
+
+inline std::int64_t dot_i8(const std::int8_t* a, const std::int8_t* b, std::size_t k) noexcept
+{
+    std::int64_t r = 0;
+    for (std::size_t p = 0; p < k; p += qdot_block)
+        r += _dot_i8_block(a + p, b + p, (k - p < qdot_block) ? k - p : qdot_block);
+    return r;
+};
+
+}; // namespace seoncore::ops::kernels
+
+namespace seoncore::ops
+{
+
+struct QGemmOperand
+{
+    const std::int8_t*  data;       // `k` contiguous codes per slice
+    const float*        scales;
+    const std::int32_t* zero_points;
+    const std::int64_t* sums;       // sum of codes per slice
+};
+
+// C (m x n, row stride ldc) = dequant(A) * dequant(B), where A holds m rows
+// quantized per row and B holds n columns quantized per column. Zero points
+// are folded in through the precomputed slice sums:
+//   sum_p (a - za)(b - zb) = sum_p a*b - zb*sum(a) - za*sum(b) + k*za*zb
+inline void qgemm(
+        std::size_t m,
+        std::size_t n,
+        std::size_t k,
+        const QGemmOperand& A,
+        const QGemmOperand& B,
+        float* C,
+        std::size_t ldc) noexcept
+{
+    constexpr std::size_t MB = 64;
+    constexpr std::size_t NB = 64;
+
+    const std::int64_t kk = static_cast<std::int64_t>(k);
+
+    for (std::size_t i0 = 0; i0 < m; i0 += MB)
+    {
+        const std::size_t i1 = (i0 + MB < m) ? i0 + MB : m;
+
+        for (std::size_t j0 = 0; j0 < n; j0 += NB)
+        {
+            const std::size_t j1 = (j0 + NB < n) ? j0 + NB : n;
+
+            for (std::size_t i = i0; i < i1; ++i)
+            {
+                const std::int8_t* a  = A.data + i * k;
+                const std::int64_t za = A.zero_points[i];
+                const std::int64_t sa = A.sums[i];
+                const float        fa = A.scales[i];
+
+                auto store = [&](std::size_t j, std::int64_t acc)
+                {
+                    const std::int64_t zb = B.zero_points[j];
+                    const std::int64_t corr = acc
+                                            - zb * sa
+                                            - za * B.sums[j]
+                                            + kk * za * zb;
+                    C[i * ldc + j] = fa * B.scales[j] * static_cast<float>(corr);
+                };
+
+                std::size_t j = j0;
+                for (; j + 4 <= j1; j += 4)
+                {
+                    std::int64_t acc[4];
+                    kernels::dot_i8x4(
+                        a,
+                        B.data + (j + 0) * k,
+                        B.data + (j + 1) * k,
+                        B.data + (j + 2) * k,
+                        B.data + (j + 3) * k,
+                        k, acc);
+
+                    for (std::size_t t = 0; t < 4; ++t)
+                        store(j + t, acc[t]);
+                };
+
+                for (; j < j1; ++j)
+                    store(j, kernels::dot_i8(a, B.data + j * k, k));
+            };
+        };
+    };
+};
+
+}; // namespace seoncore::ops
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/ops/qgemm.hpp>
+#include <seoncore/enums/axis.hpp>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/quantized.hpp>
+
+namespace seoncore::matrix
+{
+
+inline seoncore::matrix::DenseMatrix<float> tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::QuantizedMatrix& A,
+    const seoncore::matrix::QuantizedMatrix& B)
+{
+    assert(A.cols() == B.rows());
+
+    // The scales only factor out of the k-sum for row-quantized A and
+    // column-quantized B; anything else goes through float.
+    if (A.axis() != seoncore::enums::Axis::Row || B.axis() != seoncore::enums::Axis::Column)
+        return seoncore::ops::matmul(A.dequantize(), B.dequantize());
+
+    seoncore::matrix::DenseMatrix<float> C(A.rows(), B.cols());
+
+    const seoncore::ops::QGemmOperand qa {
+        A.data(), A.scales().data(), A.zero_points().data(), A.sums().data()
+    };
+    const seoncore::ops::QGemmOperand qb {
+        B.data(), B.scales().data(), B.zero_points().data(), B.sums().data()
+    };
+
+    seoncore::ops::qgemm(A.rows(), B.cols(), A.cols(), qa, qb, C.data(), C.cols());
+    return C;
+};
+
+// Mixed operands quantize the float side on the fly (dynamic quantization),
+// so `Wq * x` keeps the int8 kernel without the caller quantizing `x`.
+template <seoncore::concepts::MatrixLike B>
+seoncore::matrix::DenseMatrix<float> tag_invoke(
+    seoncore::tags::matmul_t tag,
+    const seoncore::matrix::QuantizedMatrix& A,
+    const B& b)
+{
+    return tag_invoke(tag, A, seoncore::matrix::quantize(b, seoncore::enums::Axis::Column));
+};
+
+template <seoncore::concepts::MatrixLike A>
+seoncore::matrix::DenseMatrix<float> tag_invoke(
+    seoncore::tags::matmul_t tag,
+    const A& a,
+    const seoncore::matrix::QuantizedMatrix& B)
+{
+    return tag_invoke(tag, seoncore::matrix::quantize(a, seoncore::enums::Axis::Row), B);
+};
+
+}; // namespace seoncore::matrix
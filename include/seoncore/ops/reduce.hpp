@@ -4,6 +4,8 @@
 #include <numeric>
 #include <seoncore/concepts/matrix_like.hpp>
 #include <seoncore/views/vec.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
 
 namespace seoncore::ops
 {
@@ -15,6 +17,9 @@ constexpr auto sum(const A& a) -> typename std::remove_cvref_t<A>::value_type
     using M = std::remove_cvref_t<A>;
     using TN = typename M::value_type;
 
+    SEONCORE_OP_SCOPE("sum", seoncore::enums::Path::Direct, a.rows(), a.cols(), 0,
+                      a.rows() * a.cols(), a.rows() * a.cols() * sizeof(TN));
+
     seoncore::views::VectorView<TN> tmp = a.flatten();
     return std::accumulate(tmp.begin(), tmp.end(), 0.0);
 };
@@ -26,6 +31,9 @@ constexpr auto min(const A& a) -> typename std::remove_cvref_t<A>::value_type
     using M = std::remove_cvref_t<A>;
     using TN = typename M::value_type;
 
+    SEONCORE_OP_SCOPE("min", seoncore::enums::Path::Direct, a.rows(), a.cols(), 0,
+                      a.rows() * a.cols(), a.rows() * a.cols() * sizeof(TN));
+
     seoncore::views::VectorView<TN> tmp = a.flatten();
     return *std::min_element(tmp.begin(), tmp.end());
 };
@@ -37,6 +45,9 @@ constexpr auto max(const A& a) -> typename std::remove_cvref_t<A>::value_type
     using M = std::remove_cvref_t<A>;
     using TN = typename M::value_type;
 
+    SEONCORE_OP_SCOPE("max", seoncore::enums::Path::Direct, a.rows(), a.cols(), 0,
+                      a.rows() * a.cols(), a.rows() * a.cols() * sizeof(TN));
+
     seoncore::views::VectorView<TN> tmp = a.flatten();
     return *std::max_element(tmp.begin(), tmp.end());
 };
@@ -0,0 +1,554 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <seoncore/enums/axis.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/strided.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+#include <seoncore/views/vec.hpp>
+
+// Sorting along every row (Axis::Row) or every column (Axis::Column) of a
+// matrix, and along a single row()/col() view:
+//
+//   sort        in place
+//   argsort     the permutation that sorts each line
+//   topk        the k first elements of each line in order, with indices
+//   partition   in place; element k lands where a full sort would put it,
+//               with no element after it ordered before it
+//
+// Values are mapped to unsigned keys that compare like the values, so all
+// kernels work on integers. Lines of up to sort_network_max elements go
+// through a sorting network run on sort_lanes lines at once, one line per
+// vector lane; long lines are radix sorted, and lengths in between use
+// std::sort on the keys. Lines are spread across the thread pool.
+//
+// Equal values keep their index order, so argsort and topk are stable and
+// do not depend on the thread count. NaNs order after every number in
+// both directions (sort writes them back as a quiet NaN), and -0.0 orders
+// before +0.0.
+
+namespace seoncore::ops
+{
+
+enum class SortOrder
+{
+    Ascending,
+    Descending
+};
+
+template <class TN>
+concept Sortable =
+    (std::integral<TN> && !std::same_as<TN, bool>) || std::same_as<TN, float> || std::same_as<TN, double>;
+
+// Lines of a matrix reduced to their k first elements, in order. Shaped
+// like the input with the sorted axis cut to k: m x k for Axis::Row,
+// k x n for Axis::Column.
+template <typename TN>
+struct TopkResult
+{
+    seoncore::matrix::DenseMatrix<std::size_t>  indices;
+    seoncore::matrix::DenseMatrix<TN>           values;
+};
+
+namespace detail
+{
+
+inline constexpr std::size_t sort_network_max = 32;
+inline constexpr std::size_t sort_lanes = 16;
+
+// Shortest line radix sorted, per 4 bytes of key: below it the 256-bucket
+// passes cost more than comparison sorting.
+inline constexpr std::size_t sort_radix_min = 64;
+
+template <class K>
+constexpr bool _use_radix(std::size_t n) noexcept { return n >= sort_radix_min * (sizeof(K) / 4); };
+
+// Elements per parallel work item.
+inline constexpr std::size_t sort_grain = std::size_t{1} << 14;
+
+// Order-preserving map between TN and an unsigned key: floats flip all
+// bits when negative and the sign bit otherwise, signed integers flip the
+// sign bit, and Descending complements the key. NaN is the largest key.
+template <Sortable TN>
+struct _sort_key
+{
+    using type = std::conditional_t<sizeof(TN) <= 4, std::uint32_t, std::uint64_t>;
+
+    static constexpr type top = type{1} << (sizeof(type) * 8 - 1);
+    static constexpr type nan = ~type{0};
+
+    static type to(TN v, bool desc) noexcept
+    {
+        type k;
+        if constexpr (std::floating_point<TN>)
+        {
+            if (v != v) return nan;
+            const type u = std::bit_cast<type>(v);
+            k = (u & top) ? ~u : (u | top);
+        }
+        else
+        {
+            k = static_cast<type>(static_cast<std::make_unsigned_t<TN>>(v));
+            if constexpr (std::is_signed_v<TN>)
+                k ^= type{1} << (sizeof(TN) * 8 - 1);
+        };
+        return desc ? ~k : k;
+    };
+
+    static TN from(type k, bool desc) noexcept
+    {
+        if constexpr (std::floating_point<TN>)
+        {
+            if (k == nan) return std::numeric_limits<TN>::quiet_NaN();
+            if (desc) k = ~k;
+            return std::bit_cast<TN>((k & top) ? (k ^ top) : ~k);
+        }
+        else
+        {
+            if (desc) k = ~k;
+            if constexpr (std::is_signed_v<TN>)
+                k ^= type{1} << (sizeof(TN) * 8 - 1);
+            return static_cast<TN>(static_cast<std::make_unsigned_t<TN>>(k));
+        };
+    };
+};
+
+// Lines of a strided matrix: line i, element p at data[i * ls + p * es].
+template <class P>
+struct _lines
+{
+    P               data;
+    std::size_t     count;
+    std::size_t     length;
+    std::ptrdiff_t  ls;
+    std::ptrdiff_t  es;
+
+    P at(std::size_t i, std::size_t p) const noexcept
+    {
+        return data + static_cast<std::ptrdiff_t>(i) * ls + static_cast<std::ptrdiff_t>(p) * es;
+    };
+};
+
+template <class P, typename TN>
+_lines<P> _lines_of(P data, const seoncore::matrix::StridedLayout<TN>& l, seoncore::enums::Axis axis) noexcept
+{
+    if (axis == seoncore::enums::Axis::Row)
+        return { data, l.rows, l.cols, l.rs, l.cs };
+    return { data, l.cols, l.rows, l.cs, l.rs };
+};
+
+// Output lines for argsort/topk results: row-major m x n (or m x k and
+// k x n) matrices written along the same axis as the input.
+template <typename TN>
+_lines<TN*> _out_lines(seoncore::matrix::DenseMatrix<TN>& M, seoncore::enums::Axis axis) noexcept
+{
+    return _lines_of(M.data(), seoncore::matrix::StridedLayout<TN>{
+        M.data(), M.rows(), M.cols(), static_cast<std::ptrdiff_t>(M.cols()), 1 }, axis);
+};
+
+using _network = std::vector<std::pair<std::uint8_t, std::uint8_t>>;
+
+// Batcher's odd-even merge sort for the next power of two, minus the
+// comparators that reach past n: with the missing inputs taken as +inf
+// those never move anything.
+inline const _network& _sort_network(std::size_t n)
+{
+    static const auto networks = []
+    {
+        std::array<_network, sort_network_max + 1> out;
+        for (std::size_t len = 2; len <= sort_network_max; ++len)
+        {
+            const std::size_t P = std::bit_ceil(len);
+            for (std::size_t p = 1; p < P; p <<= 1)
+                for (std::size_t k = p; k >= 1; k >>= 1)
+                    for (std::size_t j = k % p; j + k < P; j += 2 * k)
+                        for (std::size_t i = 0; i < std::min(k, P - j - k); ++i)
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < len)
+                                out[len].emplace_back(std::uint8_t(i + j), std::uint8_t(i + j + k));
+        };
+        return out;
+    }();
+    return networks[n];
+};
+
+// keys[p * sort_lanes + l] is element p of lane l; every lane is sorted
+// at once, the lane loop being what the compiler vectorizes.
+template <class K>
+void _network_sort(K* keys, const _network& net) noexcept
+{
+    for (const auto& [a, b] : net)
+    {
+        K* x = keys + a * sort_lanes;
+        K* y = keys + b * sort_lanes;
+        // All loads before any store: x and y never overlap, but the
+        // compiler cannot tell, and would not vectorize otherwise.
+        K lo[sort_lanes], hi[sort_lanes];
+        for (std::size_t l = 0; l < sort_lanes; ++l)
+        {
+            lo[l] = std::min(x[l], y[l]);
+            hi[l] = std::max(x[l], y[l]);
+        };
+        std::copy_n(lo, sort_lanes, x);
+        std::copy_n(hi, sort_lanes, y);
+    };
+};
+
+// Same, carrying each key's index along and breaking ties by it.
+template <class K>
+void _network_sort(K* keys, std::uint32_t* idx, const _network& net) noexcept
+{
+    for (const auto& [a, b] : net)
+    {
+        K* x = keys + a * sort_lanes;
+        K* y = keys + b * sort_lanes;
+        std::uint32_t* ix = idx + a * sort_lanes;
+        std::uint32_t* iy = idx + b * sort_lanes;
+        for (std::size_t l = 0; l < sort_lanes; ++l)
+        {
+            const bool swap = (y[l] < x[l]) | ((y[l] == x[l]) & (iy[l] < ix[l]));
+            const K kx = swap ? y[l] : x[l];
+            const K ky = swap ? x[l] : y[l];
+            const std::uint32_t jx = swap ? iy[l] : ix[l];
+            const std::uint32_t jy = swap ? ix[l] : iy[l];
+            x[l] = kx;
+            y[l] = ky;
+            ix[l] = jx;
+            iy[l] = jy;
+        };
+    };
+};
+
+// LSD radix sort on bytes; a byte all keys share costs no pass. idx, when
+// given, is permuted along. Stable, so equal keys keep their index order.
+template <class K>
+void _radix_sort(K* keys, K* ktmp, std::size_t* idx, std::size_t* itmp, std::size_t n) noexcept
+{
+    constexpr std::size_t passes = sizeof(K);
+    std::array<std::array<std::size_t, 256>, passes> counts{};
+
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t p = 0; p < passes; ++p)
+            ++counts[p][(keys[i] >> (8 * p)) & 0xFF];
+
+    K* const kout = keys;
+    std::size_t* const iout = idx;
+
+    for (std::size_t p = 0; p < passes; ++p)
+    {
+        std::array<std::size_t, 256>& c = counts[p];
+        if (c[(keys[0] >> (8 * p)) & 0xFF] == n) continue;
+
+        std::size_t sum = 0;
+        for (std::size_t& v : c)
+        {
+            const std::size_t t = v;
+            v = sum;
+            sum += t;
+        };
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const std::size_t to = c[(keys[i] >> (8 * p)) & 0xFF]++;
+            ktmp[to] = keys[i];
+            if (idx) itmp[to] = idx[i];
+        };
+        std::swap(keys, ktmp);
+        std::swap(idx, itmp);
+    };
+
+    if (keys != kout)
+    {
+        std::copy(keys, keys + n, kout);
+        if (idx) std::copy(idx, idx + n, iout);
+    };
+};
+
+template <class F>
+void _for_lines(std::size_t count, std::size_t length, F&& fn)
+{
+    const std::size_t grain = std::max<std::size_t>(1, sort_grain / std::max<std::size_t>(length, 1));
+    seoncore::parallel::parallel_for(count, grain, std::forward<F>(fn));
+};
+
+// Runs fn(keys, first, lanes) on lines [lo, hi) sort_lanes at a time,
+// after the lines' keys are loaded lane-wise into keys.
+template <Sortable TN, class P, class F>
+void _network_groups(const _lines<P>& in, std::size_t lo, std::size_t hi, bool desc,
+                     std::vector<typename _sort_key<TN>::type>& keys, F&& fn)
+{
+    using key = _sort_key<TN>;
+    const std::size_t n = in.length;
+    keys.assign(n * sort_lanes, typename key::type{});
+
+    for (std::size_t g = lo; g < hi; g += sort_lanes)
+    {
+        const std::size_t lanes = std::min(sort_lanes, hi - g);
+        for (std::size_t l = 0; l < lanes; ++l)
+            for (std::size_t p = 0; p < n; ++p)
+                keys[p * sort_lanes + l] = key::to(*in.at(g + l, p), desc);
+        fn(g, lanes);
+    };
+};
+
+template <Sortable TN>
+void _sort_lines(const _lines<TN*>& in, bool desc)
+{
+    using key = _sort_key<TN>;
+    using K = typename key::type;
+    const std::size_t n = in.length;
+    if (n < 2) return;
+
+    _for_lines(in.count, n, [&](std::size_t lo, std::size_t hi)
+    {
+        std::vector<K> keys;
+        if (n <= sort_network_max)
+        {
+            const _network& net = _sort_network(n);
+            _network_groups<TN>(in, lo, hi, desc, keys, [&](std::size_t g, std::size_t lanes)
+            {
+                _network_sort(keys.data(), net);
+                for (std::size_t l = 0; l < lanes; ++l)
+                    for (std::size_t p = 0; p < n; ++p)
+                        *in.at(g + l, p) = key::from(keys[p * sort_lanes + l], desc);
+            });
+            return;
+        };
+
+        keys.resize(n);
+        std::vector<K> tmp(_use_radix<K>(n) ? n : 0);
+        for (std::size_t i = lo; i < hi; ++i)
+        {
+            for (std::size_t p = 0; p < n; ++p) keys[p] = key::to(*in.at(i, p), desc);
+
+            if (_use_radix<K>(n)) _radix_sort(keys.data(), tmp.data(), nullptr, nullptr, n);
+            else std::sort(keys.begin(), keys.end());
+
+            for (std::size_t p = 0; p < n; ++p) *in.at(i, p) = key::from(keys[p], desc);
+        };
+    });
+};
+
+template <Sortable TN>
+void _partition_lines(const _lines<TN*>& in, std::size_t k, bool desc)
+{
+    using key = _sort_key<TN>;
+    using K = typename key::type;
+    const std::size_t n = in.length;
+
+    if (n <= sort_network_max)
+    {
+        _sort_lines(in, desc);
+        return;
+    };
+
+    _for_lines(in.count, n, [&](std::size_t lo, std::size_t hi)
+    {
+        std::vector<K> keys(n);
+        for (std::size_t i = lo; i < hi; ++i)
+        {
+            for (std::size_t p = 0; p < n; ++p) keys[p] = key::to(*in.at(i, p), desc);
+            std::nth_element(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(k), keys.end());
+            for (std::size_t p = 0; p < n; ++p) *in.at(i, p) = key::from(keys[p], desc);
+        };
+    });
+};
+
+// Writes the first k positions of each sorted line: indices into idx,
+// and the values themselves into val when given.
+template <Sortable TN>
+void _ranked_lines(const _lines<const TN*>& in, std::size_t k, bool desc,
+                   const _lines<std::size_t*>& idx, const _lines<TN*>* val)
+{
+    using key = _sort_key<TN>;
+    using K = typename key::type;
+    const std::size_t n = in.length;
+    if (k == 0) return;
+
+    auto emit = [&](std::size_t i, std::size_t t, std::size_t j)
+    {
+        *idx.at(i, t) = j;
+        if (val) *val->at(i, t) = *in.at(i, j);
+    };
+
+    _for_lines(in.count, n, [&](std::size_t lo, std::size_t hi)
+    {
+        if (n <= sort_network_max)
+        {
+            const _network& net = _sort_network(n);
+            std::vector<K> keys;
+            std::vector<std::uint32_t> order(n * sort_lanes);
+            _network_groups<TN>(in, lo, hi, desc, keys, [&](std::size_t g, std::size_t lanes)
+            {
+                for (std::size_t p = 0; p < n; ++p)
+                    std::fill_n(order.begin() + static_cast<std::ptrdiff_t>(p * sort_lanes), sort_lanes, std::uint32_t(p));
+                _network_sort(keys.data(), order.data(), net);
+                for (std::size_t l = 0; l < lanes; ++l)
+                    for (std::size_t t = 0; t < k; ++t)
+                        emit(g + l, t, order[t * sort_lanes + l]);
+            });
+            return;
+        };
+
+        if (k == n && _use_radix<K>(n))
+        {
+            std::vector<K> keys(n), ktmp(n);
+            std::vector<std::size_t> order(n), otmp(n);
+            for (std::size_t i = lo; i < hi; ++i)
+            {
+                for (std::size_t p = 0; p < n; ++p)
+                {
+                    keys[p] = key::to(*in.at(i, p), desc);
+                    order[p] = p;
+                };
+                _radix_sort(keys.data(), ktmp.data(), order.data(), otmp.data(), n);
+                for (std::size_t t = 0; t < k; ++t) emit(i, t, order[t]);
+            };
+            return;
+        };
+
+        // (key, index) pairs compare exactly in the order wanted, ties
+        // included; selecting k first keeps it O(n + k log k).
+        std::vector<std::pair<K, std::size_t>> pairs(n);
+        const auto kth = pairs.begin() + static_cast<std::ptrdiff_t>(k);
+        for (std::size_t i = lo; i < hi; ++i)
+        {
+            for (std::size_t p = 0; p < n; ++p) pairs[p] = { key::to(*in.at(i, p), desc), p };
+            if (k < n) std::nth_element(pairs.begin(), kth, pairs.end());
+            std::sort(pairs.begin(), kth);
+            for (std::size_t t = 0; t < k; ++t) emit(i, t, pairs[t].second);
+        };
+    });
+};
+
+template <class TN, bool C>
+_lines<std::conditional_t<C, const TN*, TN*>> _vector_line(seoncore::views::BaseVectorView<TN, C> v) noexcept
+{
+    return { v.data(), 1, v.size(), 0, static_cast<std::ptrdiff_t>(v.stride()) };
+};
+
+inline double _sort_flops(std::size_t count, std::size_t n) noexcept
+{
+    return double(count) * double(n) * double(std::bit_width(n));
+};
+
+}; // namespace detail
+
+// Sorts every line of M along `axis` in place.
+template <Sortable TN, class S>
+void sort(seoncore::matrix::DenseMatrix<TN, S>& M,
+          seoncore::enums::Axis axis = seoncore::enums::Axis::Row, SortOrder order = SortOrder::Ascending)
+{
+    SEONCORE_OP_SCOPE("sort", seoncore::enums::Path::Direct, M.rows(), M.cols(), 0,
+                      detail::_sort_flops(M.rows(), M.cols()), 2.0 * M.rows() * M.cols() * sizeof(TN));
+    detail::_sort_lines(detail::_lines_of(M.data(), _strided_layout(M), axis), order == SortOrder::Descending);
+};
+
+template <Sortable TN>
+void sort(seoncore::views::MutableVectorView<TN> v, SortOrder order = SortOrder::Ascending)
+{
+    detail::_sort_lines(detail::_vector_line(v), order == SortOrder::Descending);
+};
+
+// Index matrix shaped like `a`: along each line, the positions of its
+// elements in sorted order.
+template <seoncore::matrix::StridedDense A>
+requires Sortable<typename A::value_type>
+seoncore::matrix::DenseMatrix<std::size_t> argsort(
+    const A& a, seoncore::enums::Axis axis = seoncore::enums::Axis::Row, SortOrder order = SortOrder::Ascending)
+{
+    using TN = typename A::value_type;
+
+    const auto l = seoncore::matrix::_strided_layout(a);
+    const auto in = detail::_lines_of(l.data, l, axis);
+
+    SEONCORE_OP_SCOPE("argsort", seoncore::enums::Path::Direct, l.rows, l.cols, 0,
+                      detail::_sort_flops(in.count, in.length), double(l.rows * l.cols) * (sizeof(TN) + sizeof(std::size_t)));
+
+    seoncore::matrix::DenseMatrix<std::size_t> out(l.rows, l.cols);
+    detail::_ranked_lines<TN>(in, in.length, order == SortOrder::Descending, detail::_out_lines(out, axis), nullptr);
+    return out;
+};
+
+template <Sortable TN, bool C>
+std::vector<std::size_t> argsort(seoncore::views::BaseVectorView<TN, C> v, SortOrder order = SortOrder::Ascending)
+{
+    std::vector<std::size_t> out(v.size());
+    const detail::_lines<std::size_t*> idx{ out.data(), 1, out.size(), 0, 1 };
+    detail::_ranked_lines<TN>(detail::_vector_line(seoncore::views::VectorView<TN>(v)), v.size(),
+                              order == SortOrder::Descending, idx, nullptr);
+    return out;
+};
+
+// The k largest (Descending, the default) or smallest elements of each
+// line with their positions, best first; k is clamped to the line length.
+template <seoncore::matrix::StridedDense A>
+requires Sortable<typename A::value_type>
+TopkResult<typename A::value_type> topk(
+    const A& a, std::size_t k,
+    seoncore::enums::Axis axis = seoncore::enums::Axis::Row, SortOrder order = SortOrder::Descending)
+{
+    using TN = typename A::value_type;
+
+    const auto l = seoncore::matrix::_strided_layout(a);
+    const auto in = detail::_lines_of(l.data, l, axis);
+    k = std::min(k, in.length);
+
+    SEONCORE_OP_SCOPE("topk", seoncore::enums::Path::Direct, l.rows, l.cols, k,
+                      double(in.count) * double(in.length), double(l.rows * l.cols) * sizeof(TN));
+
+    const bool by_row = (axis == seoncore::enums::Axis::Row);
+    TopkResult<TN> result{
+        seoncore::matrix::DenseMatrix<std::size_t>(by_row ? in.count : k, by_row ? k : in.count),
+        seoncore::matrix::DenseMatrix<TN>(by_row ? in.count : k, by_row ? k : in.count) };
+
+    const auto values = detail::_out_lines(result.values, axis);
+    detail::_ranked_lines<TN>(in, k, order == SortOrder::Descending, detail::_out_lines(result.indices, axis), &values);
+    return result;
+};
+
+template <Sortable TN, bool C>
+std::vector<std::size_t> topk(seoncore::views::BaseVectorView<TN, C> v, std::size_t k, SortOrder order = SortOrder::Descending)
+{
+    k = std::min(k, v.size());
+    std::vector<std::size_t> out(k);
+    const detail::_lines<std::size_t*> idx{ out.data(), 1, k, 0, 1 };
+    detail::_ranked_lines<TN>(detail::_vector_line(seoncore::views::VectorView<TN>(v)), k,
+                              order == SortOrder::Descending, idx, nullptr);
+    return out;
+};
+
+// Reorders every line so that position k holds what a full sort would put
+// there, nothing before it orders after it and nothing after it before it.
+template <Sortable TN, class S>
+void partition(seoncore::matrix::DenseMatrix<TN, S>& M, std::size_t k,
+               seoncore::enums::Axis axis = seoncore::enums::Axis::Row, SortOrder order = SortOrder::Ascending)
+{
+    const auto in = detail::_lines_of(M.data(), _strided_layout(M), axis);
+    assert(in.count == 0 || k < in.length);
+
+    SEONCORE_OP_SCOPE("partition", seoncore::enums::Path::Direct, M.rows(), M.cols(), k,
+                      double(M.rows()) * double(M.cols()), 2.0 * M.rows() * M.cols() * sizeof(TN));
+    detail::_partition_lines(in, k, order == SortOrder::Descending);
+};
+
+template <Sortable TN>
+void partition(seoncore::views::MutableVectorView<TN> v, std::size_t k, SortOrder order = SortOrder::Ascending)
+{
+    assert(v.empty() || k < v.size());
+    detail::_partition_lines(detail::_vector_line(v), k, order == SortOrder::Descending);
+};
+
+}; // namespace seoncore::ops
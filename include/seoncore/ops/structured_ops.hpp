@@ -0,0 +1,273 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/diagonal.hpp>
+#include <seoncore/matrix/banded.hpp>
+#include <seoncore/matrix/triangular.hpp>
+#include <seoncore/matrix/symmetric.hpp>
+
+// Products of a structured matrix with a DenseMatrix only visit the stored
+// part of the structured operand. Every other pairing that involves these
+// types (e.g. triangular x symmetric, or a transposed view) has no
+// overload here and goes through `matmul_fallback`, which reads zeros and
+// mirrored entries through `operator()`.
+//
+// C is written through one data() pointer (it is fresh and row-major), so
+// copy-on-write storage checks for sharing once rather than per element.
+
+namespace seoncore::matrix
+{
+
+// diag(d) * B scales row i of B by d_i.
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::DiagonalMatrix<TN>& D,
+    const seoncore::matrix::DenseMatrix<TN, S>& B)
+{
+    assert(D.cols() == B.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(B.rows(), B.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+    const auto d = D.diagonal();
+
+    for (std::size_t i = 0; i < B.rows(); ++i)
+    {
+        const TN di = d[i];
+        for (std::size_t j = 0; j < B.cols(); ++j)
+            c[i * ldc + j] = di * B(i, j);
+    };
+    return C;
+};
+
+// A * diag(d) scales column j of A by d_j.
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::DenseMatrix<TN, S>& A,
+    const seoncore::matrix::DiagonalMatrix<TN>& D)
+{
+    assert(A.cols() == D.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(A.rows(), A.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+    const auto d = D.diagonal();
+
+    for (std::size_t i = 0; i < A.rows(); ++i)
+        for (std::size_t j = 0; j < A.cols(); ++j)
+            c[i * ldc + j] = A(i, j) * d[j];
+
+    return C;
+};
+
+template <typename TN>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::DiagonalMatrix<TN>& A,
+    const seoncore::matrix::DiagonalMatrix<TN>& B)
+{
+    assert(A.cols() == B.rows());
+
+    seoncore::matrix::DiagonalMatrix<TN> C(A.rows());
+    const auto a = A.diagonal();
+    const auto b = B.diagonal();
+    auto c = C.diagonal();
+
+    for (std::size_t i = 0; i < a.size(); ++i)
+        c[i] = a[i] * b[i];
+
+    return C;
+};
+
+// Band * B: row i of C combines only the kl + ku + 1 rows of B in its band.
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::BandedMatrix<TN>& A,
+    const seoncore::matrix::DenseMatrix<TN, S>& B)
+{
+    assert(A.cols() == B.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(A.rows(), B.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+
+    for (std::size_t i = 0; i < A.rows(); ++i)
+    {
+        const TN* band = A.row_band(i);
+        const std::size_t k0 = A.row_first(i);
+        const std::size_t k1 = A.row_last(i);
+
+        for (std::size_t k = k0; k < k1; ++k)
+        {
+            const TN aik = band[k - k0];
+            for (std::size_t j = 0; j < B.cols(); ++j)
+                c[i * ldc + j] += aik * B(k, j);
+        };
+    };
+    return C;
+};
+
+// A * Band: A(i, k) only reaches the band columns of row k.
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::DenseMatrix<TN, S>& A,
+    const seoncore::matrix::BandedMatrix<TN>& B)
+{
+    assert(A.cols() == B.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(A.rows(), B.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+
+    for (std::size_t i = 0; i < A.rows(); ++i)
+    {
+        for (std::size_t k = 0; k < A.cols(); ++k)
+        {
+            const TN aik = A(i, k);
+            const TN* band = B.row_band(k);
+            const std::size_t j0 = B.row_first(k);
+            const std::size_t j1 = B.row_last(k);
+
+            for (std::size_t j = j0; j < j1; ++j)
+                c[i * ldc + j] += aik * band[j - j0];
+        };
+    };
+    return C;
+};
+
+// TRMM, triangular on the left.
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::TriangularMatrix<TN>& T,
+    const seoncore::matrix::DenseMatrix<TN, S>& B)
+{
+    assert(T.cols() == B.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(T.rows(), B.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+
+    for (std::size_t i = 0; i < T.rows(); ++i)
+    {
+        const TN* packed = T.row_packed(i);
+        const std::size_t k0 = T.row_first(i);
+        const std::size_t k1 = T.row_last(i);
+
+        for (std::size_t k = k0; k < k1; ++k)
+        {
+            const TN tik = packed[k - k0];
+            for (std::size_t j = 0; j < B.cols(); ++j)
+                c[i * ldc + j] += tik * B(k, j);
+        };
+    };
+    return C;
+};
+
+// TRMM, triangular on the right.
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::DenseMatrix<TN, S>& A,
+    const seoncore::matrix::TriangularMatrix<TN>& T)
+{
+    assert(A.cols() == T.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(A.rows(), T.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+
+    for (std::size_t i = 0; i < A.rows(); ++i)
+    {
+        for (std::size_t k = 0; k < A.cols(); ++k)
+        {
+            const TN aik = A(i, k);
+            const TN* packed = T.row_packed(k);
+            const std::size_t j0 = T.row_first(k);
+            const std::size_t j1 = T.row_last(k);
+
+            for (std::size_t j = j0; j < j1; ++j)
+                c[i * ldc + j] += aik * packed[j - j0];
+        };
+    };
+    return C;
+};
+
+// SYMM, symmetric on the left. Each packed entry s_ik (k < i) is read once
+// and used for both C(i, :) += s_ik B(k, :) and C(k, :) += s_ik B(i, :).
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::SymmetricMatrix<TN>& Sy,
+    const seoncore::matrix::DenseMatrix<TN, S>& B)
+{
+    assert(Sy.cols() == B.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(Sy.rows(), B.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+
+    for (std::size_t i = 0; i < Sy.rows(); ++i)
+    {
+        const TN* packed = Sy.row_packed(i);
+
+        for (std::size_t k = 0; k < i; ++k)
+        {
+            const TN sik = packed[k];
+            for (std::size_t j = 0; j < B.cols(); ++j)
+            {
+                c[i * ldc + j] += sik * B(k, j);
+                c[k * ldc + j] += sik * B(i, j);
+            };
+        };
+
+        const TN sii = packed[i];
+        for (std::size_t j = 0; j < B.cols(); ++j)
+            c[i * ldc + j] += sii * B(i, j);
+    };
+    return C;
+};
+
+// SYMM, symmetric on the right. Row i of C gathers A(i, :) against each
+// packed row k of S: the strictly lower part contributes to C(i, 0..k-1)
+// directly and, mirrored, to C(i, k) as a dot product.
+template <typename TN, class S>
+constexpr auto tag_invoke(
+    seoncore::tags::matmul_t,
+    const seoncore::matrix::DenseMatrix<TN, S>& A,
+    const seoncore::matrix::SymmetricMatrix<TN>& Sy)
+{
+    assert(A.cols() == Sy.rows());
+
+    seoncore::matrix::DenseMatrix<TN, S> C(A.rows(), Sy.cols());
+    TN* const c = C.data();
+    const std::size_t ldc = C.cols();
+
+    for (std::size_t i = 0; i < A.rows(); ++i)
+    {
+        for (std::size_t k = 0; k < Sy.rows(); ++k)
+        {
+            const TN* packed = Sy.row_packed(k);
+            const TN aik = A(i, k);
+
+            TN acc{};
+            for (std::size_t j = 0; j < k; ++j)
+            {
+                c[i * ldc + j] += aik * packed[j];
+                acc += A(i, j) * packed[j];
+            };
+
+            c[i * ldc + k] += acc + aik * packed[k];
+        };
+    };
+    return C;
+};
+
+}; // namespace seoncore::matrix
@@ -5,8 +5,9 @@
 #include <utility>
 #include <type_traits>
 #include <concepts>
-#include <iostream>
 #include <seoncore/ops/tag_invoke.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
 #include <seoncore/concepts/matrix_like.hpp>
 
 namespace seoncore::tags
@@ -60,15 +61,19 @@ constexpr auto abs_fallback(const A& a)
 template <seoncore::concepts::MatrixLike A>
 constexpr auto abs(const A& a)
 {
+    using value_type = std::remove_cvref_t<decltype(a(0, 0))>;
+
+    [[maybe_unused]] const std::size_t n = a.rows() * a.cols();
+    [[maybe_unused]] const double bytes = 2.0 * n * sizeof(value_type);
+
     if constexpr (has_tagged_abs<const A&>)
     {
-        // TODO: delete this "for tests" log
-        std::cout << "Abs tag invoked.\n";
+        SEONCORE_OP_SCOPE("abs", seoncore::enums::Path::Tagged, a.rows(), a.cols(), 0, n, bytes);
         return tag_invoke(seoncore::tags::abs_t{}, a);
     }
     else
     {
-        std::cout << "Abs fallback invoked.\n";
+        SEONCORE_OP_SCOPE("abs", seoncore::enums::Path::Fallback, a.rows(), a.cols(), 0, n, bytes);
         return abs_fallback(a);
     };
 };
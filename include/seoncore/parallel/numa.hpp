@@ -0,0 +1,274 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace seoncore::parallel::numa
+{
+
+struct Node
+{
+    unsigned                id;
+    std::vector<unsigned>   cpus;
+};
+
+// NUMA nodes and their CPUs, read from /sys/devices/system/node. A fake
+// topology has the same shape but no backing hardware: work is still
+// partitioned per node, while thread binding and memory policies are
+// skipped. Set SEONCORE_NUMA_FAKE to get one process-wide:
+//
+//   SEONCORE_NUMA_FAKE=2        two nodes splitting the host's CPUs
+//   SEONCORE_NUMA_FAKE=2x4      two nodes of four (virtual) CPUs each
+class Topology
+{
+public:
+    Topology() = default;
+
+    Topology(std::vector<Node> nodes, bool fake)
+        : _nodes(std::move(nodes))
+        , _fake(fake)
+    {
+        if (_nodes.empty())
+            _nodes.push_back({ 0, { 0 } });
+    };
+
+    std::size_t node_count() const noexcept { return _nodes.size(); };
+    const std::vector<Node>& nodes() const noexcept { return _nodes; };
+    const Node& node(std::size_t i) const noexcept { return _nodes[i]; };
+
+    bool fake() const noexcept { return _fake; };
+
+    // Binding and memory placement only pay off with real nodes to pick from.
+    bool placement_enabled() const noexcept { return !_fake && _nodes.size() > 1; };
+
+    // Index (not id) of the node holding `cpu`, 0 if unknown.
+    std::size_t node_of_cpu(unsigned cpu) const noexcept
+    {
+        for (std::size_t i = 0; i < _nodes.size(); ++i)
+            if (std::find(_nodes[i].cpus.begin(), _nodes[i].cpus.end(), cpu) != _nodes[i].cpus.end())
+                return i;
+        return 0;
+    };
+
+    static Topology single(unsigned cpus)
+    {
+        Node n{ 0, {} };
+        for (unsigned c = 0; c < std::max(cpus, 1u); ++c) n.cpus.push_back(c);
+        return Topology({ std::move(n) }, false);
+    };
+
+    // `nodes` fake nodes over `cpus_per_node` CPUs each, or over the host's
+    // CPUs split evenly when cpus_per_node is 0.
+    static Topology make_fake(std::size_t nodes, std::size_t cpus_per_node = 0)
+    {
+        nodes = std::max<std::size_t>(nodes, 1);
+        const std::size_t hw = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        const std::size_t total = (cpus_per_node != 0) ? nodes * cpus_per_node : std::max(hw, nodes);
+
+        std::vector<Node> out(nodes);
+        for (std::size_t i = 0; i < nodes; ++i) out[i].id = static_cast<unsigned>(i);
+        for (std::size_t c = 0; c < total; ++c)
+            out[c * nodes / total].cpus.push_back(static_cast<unsigned>(c));
+
+        return Topology(std::move(out), true);
+    };
+
+    // "N" or "NxC" as for SEONCORE_NUMA_FAKE; a single real-looking node if
+    // the spec does not parse.
+    static Topology parse_fake(std::string_view spec)
+    {
+        std::size_t nodes = 0, per = 0;
+        std::size_t i = 0;
+        while (i < spec.size() && spec[i] >= '0' && spec[i] <= '9')
+            nodes = nodes * 10 + static_cast<std::size_t>(spec[i++] - '0');
+        if (i < spec.size() && (spec[i] == 'x' || spec[i] == 'X'))
+            for (++i; i < spec.size() && spec[i] >= '0' && spec[i] <= '9'; ++i)
+                per = per * 10 + static_cast<std::size_t>(spec[i] - '0');
+
+        if (nodes == 0) return single(std::thread::hardware_concurrency());
+        return make_fake(nodes, per);
+    };
+
+    static Topology detect()
+    {
+        if (const char* fake = std::getenv("SEONCORE_NUMA_FAKE"); fake && *fake)
+            return parse_fake(fake);
+
+        std::vector<Node> nodes;
+        for (unsigned id : _read_list("/sys/devices/system/node/online"))
+        {
+            Node n{ id, _read_list("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist") };
+            if (!n.cpus.empty()) nodes.push_back(std::move(n));
+        };
+
+        if (nodes.empty()) return single(std::thread::hardware_concurrency());
+        return Topology(std::move(nodes), false);
+    };
+
+    // Parses a kernel cpu/node list such as "0-3,8-11".
+    static std::vector<unsigned> parse_list(std::string_view s)
+    {
+        std::vector<unsigned> out;
+        std::size_t i = 0;
+        auto number = [&](unsigned& v)
+        {
+            const std::size_t start = i;
+            v = 0;
+            while (i < s.size() && s[i] >= '0' && s[i] <= '9')
+                v = v * 10 + static_cast<unsigned>(s[i++] - '0');
+            return i != start;
+        };
+
+        while (i < s.size())
+        {
+            unsigned lo = 0, hi = 0;
+            if (!number(lo)) break;
+            hi = lo;
+            if (i < s.size() && s[i] == '-')
+            {
+                ++i;
+                if (!number(hi)) break;
+            };
+            for (unsigned v = lo; v <= hi; ++v) out.push_back(v);
+            if (i < s.size() && s[i] == ',') ++i;
+            else break;
+        };
+        return out;
+    };
+
+private:
+    std::vector<Node>   _nodes { Node{ 0, { 0 } } };
+    bool                _fake = false;
+
+    static std::vector<unsigned> _read_list(const std::string& path)
+    {
+        std::ifstream in(path);
+        std::string line;
+        if (!in || !std::getline(in, line)) return {};
+        return parse_list(line);
+    };
+
+}; // class Topology
+
+// Topology of this process, detected once.
+inline const Topology& system_topology()
+{
+    static const Topology t = Topology::detect();
+    return t;
+};
+
+namespace detail
+{
+
+inline int& _thread_node() noexcept
+{
+    thread_local int node = -1;
+    return node;
+};
+
+}; // namespace detail
+
+// Node index the calling thread works for: the node a pool worker was
+// assigned to, otherwise the node of the CPU it is running on.
+inline std::size_t current_node(const Topology& topo = system_topology()) noexcept
+{
+    const int assigned = detail::_thread_node();
+    if (assigned >= 0) return static_cast<std::size_t>(assigned) % topo.node_count();
+
+#if defined(__linux__)
+    if (!topo.fake())
+    {
+        const int cpu = sched_getcpu();
+        if (cpu >= 0) return topo.node_of_cpu(static_cast<unsigned>(cpu));
+    };
+#endif
+    return 0;
+};
+
+// Restricts the calling thread to the CPUs of node `node`. No-op (false)
+// for fake topologies and off Linux.
+inline bool bind_thread(const Topology& topo, std::size_t node) noexcept
+{
+    detail::_thread_node() = static_cast<int>(node);
+
+#if defined(__linux__)
+    if (!topo.placement_enabled()) return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned c : topo.node(node).cpus)
+        if (c < CPU_SETSIZE) CPU_SET(c, &set);
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+};
+
+// Memory policies, applied to whole pages of [p, p + bytes) before they
+// are first touched. They go straight to the mbind system call, so no
+// libnuma is needed; failures (old kernels, containers that forbid it)
+// leave the default local-allocation policy in place.
+enum class MemoryPolicy
+{
+    Bind,
+    Interleave
+};
+
+inline std::size_t page_size() noexcept
+{
+#if defined(__linux__)
+    static const std::size_t p = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return p;
+#else
+    return 4096;
+#endif
+};
+
+inline bool apply_policy(
+    const Topology& topo, void* p, std::size_t bytes, MemoryPolicy policy, const std::vector<std::size_t>& nodes) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if (!topo.placement_enabled() || bytes == 0 || nodes.empty()) return false;
+
+    const std::size_t page = page_size();
+    const auto addr = reinterpret_cast<std::uintptr_t>(p);
+    const std::uintptr_t lo = (addr + page - 1) / page * page;
+    const std::uintptr_t hi = (addr + bytes) / page * page;
+    if (hi <= lo) return false;
+
+    constexpr std::size_t words = 16;   // up to 1024 node ids
+    unsigned long mask[words] = {};
+    for (std::size_t n : nodes)
+    {
+        const unsigned id = topo.node(n).id;
+        if (id < words * 64) mask[id / 64] |= 1ul << (id % 64);
+    };
+
+    constexpr int mpol_bind = 2;
+    constexpr int mpol_interleave = 3;
+    const int mode = (policy == MemoryPolicy::Bind) ? mpol_bind : mpol_interleave;
+
+    return syscall(SYS_mbind, reinterpret_cast<void*>(lo), hi - lo, mode, mask, words * 64 + 1, 0) == 0;
+#else
+    (void)topo; (void)p; (void)bytes; (void)policy; (void)nodes;
+    return false;
+#endif
+};
+
+}; // namespace seoncore::parallel::numa
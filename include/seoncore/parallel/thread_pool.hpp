@@ -0,0 +1,371 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <seoncore/parallel/numa.hpp>
+
+namespace seoncore::parallel
+{
+
+// Fixed set of worker threads shared by every parallel kernel in the
+// library. `parallel_for` has the calling thread work alongside the
+// workers and takes back whatever helpers have not started yet, so nested
+// or concurrent calls never wait on a busy pool. Apart from growing the
+// task queue the first few times, a `parallel_for` call does not allocate.
+//
+// Workers are spread over the NUMA nodes of `topology` in contiguous runs
+// and, on a real multi-node host, bound to their node's CPUs.
+class ThreadPool
+{
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type max_groups = 16;
+
+    explicit ThreadPool(size_type workers, numa::Topology topology = numa::system_topology())
+        : _topo(std::move(topology))
+    {
+        _queue.reserve(64);
+        _threads.reserve(workers);
+        for (size_type t = 0; t < workers; ++t)
+            _threads.emplace_back([this, t, workers]
+            {
+                numa::bind_thread(_topo, worker_node(t, workers));
+                _worker();
+            });
+    };
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lk(_mx);
+            _stop = true;
+        };
+        _cv.notify_all();
+
+        for (auto& t : _threads)
+            t.join();
+    };
+
+    // Worker threads, not counting callers.
+    size_type size() const noexcept { return _threads.size(); };
+
+    // Threads that execute a `parallel_for`: the workers plus the caller.
+    size_type concurrency() const noexcept { return _threads.size() + 1; };
+
+    const numa::Topology& topology() const noexcept { return _topo; };
+
+    // Node of worker t when there are `workers` of them. The caller counts
+    // as slot 0, so with one worker per CPU every node gets its share.
+    size_type worker_node(size_type t, size_type workers) const noexcept
+    {
+        return (t + 1) * _topo.node_count() / (workers + 1);
+    };
+
+    // Fire-and-forget task. A pool without workers runs it on the spot,
+    // since nothing else would.
+    void submit(std::function<void()> fn)
+    {
+        if (_threads.empty())
+        {
+            fn();
+            return;
+        };
+
+        auto* heap = new std::function<void()>(std::move(fn));
+        _push({ &_run_function, heap }, 1);
+    };
+
+    // Runs one queued task on the calling thread, if any. Lets a thread
+    // that waits on pool work help with it instead of blocking.
+    bool run_pending()
+    {
+        _task t;
+        {
+            std::lock_guard<std::mutex> lk(_mx);
+            if (_queue.empty()) return false;
+
+            t = _queue.front();
+            _queue.erase(_queue.begin());
+        };
+
+        t.run(t.ctx);
+        return true;
+    };
+
+    // Calls fn(lo, hi) over a partition of [0, n) into contiguous chunks of
+    // at least `grain` elements. Chunk boundaries depend only on n, grain
+    // and concurrency(), never on scheduling.
+    template <class F>
+    void parallel_for(size_type n, size_type grain, F&& fn)
+    {
+        auto body = [&fn](size_type, size_type lo, size_type hi) { fn(lo, hi); };
+        _run_chunks(n, chunk_count(n, grain), body, 1);
+    };
+
+    // parallel_for with NUMA affinity: [0, n) is cut into one contiguous
+    // part per node, (approximately) at g * n / nodes, and threads take
+    // chunks of their own node's part first, stealing from other parts only
+    // once it is exhausted. Data laid out along the same index and
+    // first-touched this way therefore stays node-local.
+    template <class F>
+    void parallel_for_local(size_type n, size_type grain, F&& fn)
+    {
+        const size_type groups = std::min(_topo.node_count(), max_groups);
+        const size_type chunks = std::max(chunk_count(n, grain), std::min(groups, n));
+
+        auto body = [&fn](size_type, size_type lo, size_type hi) { fn(lo, hi); };
+        _run_chunks(n, chunks, body, groups);
+    };
+
+    // Reduces map(lo, hi) over the same kind of partition. Partials are
+    // combined in chunk order, so for a given concurrency() the result is
+    // reproducible bit for bit.
+    template <class T, class Map, class Combine>
+    T parallel_reduce(size_type n, size_type grain, T init, Map&& map, Combine&& combine)
+    {
+        const size_type chunks = std::min(chunk_count(n, grain), max_reduce_chunks);
+
+        std::array<T, max_reduce_chunks> partial{};
+        auto body = [&](size_type c, size_type lo, size_type hi) { partial[c] = map(lo, hi); };
+        _run_chunks(n, chunks, body, 1);
+
+        for (size_type c = 0; c < chunks; ++c)
+            init = combine(init, partial[c]);
+
+        return init;
+    };
+
+    static constexpr size_type max_reduce_chunks = 64;
+
+    size_type chunk_count(size_type n, size_type grain) const noexcept
+    {
+        if (grain == 0) grain = 1;
+        const size_type by_grain = (n + grain - 1) / grain;
+        return std::min(by_grain, concurrency() * 4);
+    };
+
+    // [lo, hi) of chunk c out of `chunks` over n elements.
+    static constexpr std::pair<size_type, size_type>
+    chunk_range(size_type n, size_type chunks, size_type c) noexcept
+    {
+        return { c * n / chunks, (c + 1) * n / chunks };
+    };
+
+private:
+    struct _task
+    {
+        void (*run)(void*);
+        void* ctx;
+    };
+
+    // Chunks are split into `groups` contiguous runs with a cursor each;
+    // a thread starts on the run of its NUMA node and then moves on to
+    // the others. Plain parallel_for uses a single group.
+    template <class Fn>
+    struct _range_job
+    {
+        _range_job(Fn& f, size_type n_, size_type chunks_, size_type groups_, ThreadPool* pool_) noexcept
+            : fn(f), n(n_), chunks(chunks_), groups(groups_), helpers(0), pool(pool_)
+        {
+            for (size_type g = 0; g < groups; ++g)
+                next[g].store(0, std::memory_order_relaxed);
+        };
+
+        Fn&                                             fn;
+        size_type                                       n;
+        size_type                                       chunks;
+        size_type                                       groups;
+        std::array<std::atomic<size_type>, max_groups>  next;
+        size_type                                       helpers;    // guarded by the pool mutex
+        ThreadPool*                                     pool;
+        std::atomic<bool>                               failed{false};
+        std::exception_ptr                              error;      // first exception thrown by fn
+
+        // Runs chunks until none are left or fn has thrown somewhere; the
+        // first exception is kept for the caller and later ones dropped.
+        void drain() noexcept
+        {
+            const size_type home = (groups == 1) ? 0 : numa::current_node(pool->_topo) % groups;
+
+            for (size_type k = 0; k < groups; ++k)
+            {
+                const size_type g = (home + k) % groups;
+                const size_type first = g * chunks / groups;
+                const size_type last = (g + 1) * chunks / groups;
+
+                for (size_type c = first + next[g].fetch_add(1, std::memory_order_relaxed);
+                     c < last && !failed.load(std::memory_order_relaxed);
+                     c = first + next[g].fetch_add(1, std::memory_order_relaxed))
+                {
+                    const auto [lo, hi] = chunk_range(n, chunks, c);
+                    try
+                    {
+                        fn(c, lo, hi);
+                    }
+                    catch (...)
+                    {
+                        if (!failed.exchange(true)) error = std::current_exception();
+                        return;
+                    };
+                };
+            };
+        };
+
+        static void run(void* p)
+        {
+            auto* job = static_cast<_range_job*>(p);
+            job->drain();
+            job->pool->_helper_done(job->helpers);
+        };
+    };
+
+    // Runs fn(c, lo, hi) for every chunk c of [0, n). If fn throws, the
+    // chunks not yet started are skipped and, once every helper has
+    // returned, the first exception is rethrown on the caller.
+    template <class Fn>
+    void _run_chunks(size_type n, size_type chunks, Fn& fn, size_type groups)
+    {
+        if (n == 0) return;
+
+        if (chunks <= 1)
+        {
+            fn(size_type{0}, size_type{0}, n);
+            return;
+        };
+
+        _range_job<Fn> job(fn, n, chunks, std::min(groups, chunks), this);
+
+        const size_type helpers = std::min(size(), chunks - 1);
+        job.helpers = helpers;
+        _push({ &_range_job<Fn>::run, &job }, helpers);
+
+        job.drain();
+
+        std::unique_lock<std::mutex> lk(_mx);
+        job.helpers -= _revoke_locked(&job);
+        _done.wait(lk, [&] { return job.helpers == 0; });
+        lk.unlock();
+
+        if (job.error) std::rethrow_exception(job.error);
+    };
+
+    numa::Topology              _topo;
+    std::vector<std::thread>    _threads;
+    std::vector<_task>          _queue;
+    std::mutex                  _mx;
+    std::condition_variable     _cv;
+    std::condition_variable     _done;
+    bool                        _stop = false;
+
+    static void _run_function(void* p)
+    {
+        std::unique_ptr<std::function<void()>> fn(static_cast<std::function<void()>*>(p));
+        (*fn)();
+    };
+
+    void _push(_task t, size_type count)
+    {
+        if (count == 0) return;
+
+        {
+            std::lock_guard<std::mutex> lk(_mx);
+            for (size_type i = 0; i < count; ++i)
+                _queue.push_back(t);
+        };
+
+        if (count == 1) _cv.notify_one();
+        else            _cv.notify_all();
+    };
+
+    size_type _revoke_locked(void* ctx) noexcept
+    {
+        const size_type before = _queue.size();
+        _queue.erase(
+            std::remove_if(_queue.begin(), _queue.end(), [ctx](const _task& t) { return t.ctx == ctx; }),
+            _queue.end());
+        return before - _queue.size();
+    };
+
+    void _helper_done(size_type& helpers) noexcept
+    {
+        std::lock_guard<std::mutex> lk(_mx);
+        if (--helpers == 0) _done.notify_all();
+    };
+
+    void _worker()
+    {
+        for (;;)
+        {
+            _task t;
+            {
+                std::unique_lock<std::mutex> lk(_mx);
+                _cv.wait(lk, [this] { return _stop || !_queue.empty(); });
+
+                if (_queue.empty()) return;
+
+                t = _queue.front();
+                _queue.erase(_queue.begin());
+            };
+
+            t.run(t.ctx);
+        };
+    };
+
+}; // class ThreadPool
+
+// Worker count for the shared pool: SEONCORE_NUM_THREADS if set (total
+// threads including the caller), otherwise one per hardware thread.
+inline std::size_t default_concurrency() noexcept
+{
+    if (const char* env = std::getenv("SEONCORE_NUM_THREADS"))
+    {
+        const long v = std::strtol(env, nullptr, 10);
+        if (v >= 1) return static_cast<std::size_t>(v);
+    };
+
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : hw;
+};
+
+inline ThreadPool& default_pool()
+{
+    static ThreadPool pool(default_concurrency() - 1);
+    return pool;
+};
+
+template <class F>
+void parallel_for(std::size_t n, std::size_t grain, F&& fn)
+{
+    default_pool().parallel_for(n, grain, std::forward<F>(fn));
+};
+
+template <class F>
+void parallel_for_local(std::size_t n, std::size_t grain, F&& fn)
+{
+    default_pool().parallel_for_local(n, grain, std::forward<F>(fn));
+};
+
+template <class T, class Map, class Combine>
+T parallel_reduce(std::size_t n, std::size_t grain, T init, Map&& map, Combine&& combine)
+{
+    return default_pool().parallel_reduce(
+        n, grain, std::move(init), std::forward<Map>(map), std::forward<Combine>(combine));
+};
+
+}; // namespace seoncore::parallel
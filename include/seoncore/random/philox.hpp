@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace seoncore::random
+{
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as
+// 1, 2, 3", SC'11): a keyed bijection from a 128-bit counter to 128 random
+// bits. There is no state to advance, so block b of a stream can be
+// computed by whichever thread needs it, in any order, with the same
+// result. The key is the seed; the upper counter half selects a stream.
+class Philox4x32
+{
+public:
+    using block_type = std::array<std::uint32_t, 4>;
+
+    static constexpr std::size_t rounds = 10;
+
+    constexpr Philox4x32() noexcept = default;
+
+    constexpr explicit Philox4x32(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+        : _k0(static_cast<std::uint32_t>(seed))
+        , _k1(static_cast<std::uint32_t>(seed >> 32))
+        , _s0(static_cast<std::uint32_t>(stream))
+        , _s1(static_cast<std::uint32_t>(stream >> 32))
+    {};
+
+    // Raw bijection on an explicit counter.
+    constexpr block_type operator()(block_type ctr) const noexcept
+    {
+        std::uint32_t k0 = _k0, k1 = _k1;
+        for (std::size_t r = 0; r < rounds; ++r)
+        {
+            if (r != 0) { k0 += w0; k1 += w1; };
+            _round(ctr[0], ctr[1], ctr[2], ctr[3], k0, k1);
+        };
+        return ctr;
+    };
+
+    // Block `index` of this engine's stream.
+    constexpr block_type block(std::uint64_t index) const noexcept
+    {
+        return (*this)({ static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32), _s0, _s1 });
+    };
+
+    // Blocks first .. first + N - 1 into out[lane][i], lane-major, so the
+    // rounds run across N independent counters and vectorize.
+    template <std::size_t N>
+    constexpr void blocks(std::uint64_t first, std::array<std::array<std::uint32_t, N>, 4>& out) const noexcept
+    {
+        auto& [c0, c1, c2, c3] = out;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const std::uint64_t index = first + i;
+            c0[i] = static_cast<std::uint32_t>(index);
+            c1[i] = static_cast<std::uint32_t>(index >> 32);
+            c2[i] = _s0;
+            c3[i] = _s1;
+        };
+
+        std::uint32_t k0 = _k0, k1 = _k1;
+        for (std::size_t r = 0; r < rounds; ++r)
+        {
+            if (r != 0) { k0 += w0; k1 += w1; };
+            for (std::size_t i = 0; i < N; ++i)
+                _round(c0[i], c1[i], c2[i], c3[i], k0, k1);
+        };
+    };
+
+private:
+    static constexpr std::uint32_t m0 = 0xD2511F53u;
+    static constexpr std::uint32_t m1 = 0xCD9E8D57u;
+    static constexpr std::uint32_t w0 = 0x9E3779B9u;
+    static constexpr std::uint32_t w1 = 0xBB67AE85u;
+
+    std::uint32_t _k0 = 0, _k1 = 0;
+    std::uint32_t _s0 = 0, _s1 = 0;
+
+    static constexpr void _round(
+        std::uint32_t& x0, std::uint32_t& x1, std::uint32_t& x2, std::uint32_t& x3,
+        std::uint32_t k0, std::uint32_t k1) noexcept
+    {
+        const std::uint64_t p0 = std::uint64_t{m0} * x0;
+        const std::uint64_t p1 = std::uint64_t{m1} * x2;
+
+        const std::uint32_t y0 = static_cast<std::uint32_t>(p1 >> 32) ^ x1 ^ k0;
+        const std::uint32_t y2 = static_cast<std::uint32_t>(p0 >> 32) ^ x3 ^ k1;
+
+        x1 = static_cast<std::uint32_t>(p1);
+        x3 = static_cast<std::uint32_t>(p0);
+        x0 = y0;
+        x2 = y2;
+    };
+
+}; // class Philox4x32
+
+}; // namespace seoncore::random
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/enums/path.hpp>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+#include <seoncore/random/philox.hpp>
+
+// Random matrices from a counter-based generator. Element (i, j) is a pure
+// function of (seed, stream, i * cols + j): output does not depend on the
+// thread count, on how the pool splits the work, or on the storage order,
+// so a row-major and a column-major matrix from the same seed are equal.
+//
+//   auto W = random::random_normal<float>(512, 256, seed, 0.0f, 0.02f);
+//   random::fill_uniform(M, seed, -1.0, 1.0, /*stream=*/layer);
+
+namespace seoncore::random
+{
+
+namespace detail
+{
+
+inline constexpr std::size_t fill_grain = std::size_t{1} << 14;
+inline constexpr std::size_t fill_batch = 8;      // Philox blocks per vectorized step
+
+// Values drawn from one 128-bit block: four 24-bit floats or two 53-bit
+// doubles (and wider types).
+template <typename TN>
+inline constexpr std::size_t per_block = (sizeof(TN) <= 4) ? 4 : 2;
+
+// Uniform on [0, 1) from 32 (float) or 64 (double) random bits.
+template <typename TN>
+constexpr TN unit(std::uint32_t a, std::uint32_t b = 0) noexcept
+{
+    if constexpr (per_block<TN> == 4)
+        return static_cast<TN>(a >> 8) * TN(0x1.0p-24);
+    else
+        return static_cast<TN>(((std::uint64_t{a} << 32) | b) >> 11) * TN(0x1.0p-53);
+};
+
+// Writes gen(block, out) -> per_block<TN> values for every element of M,
+// element k of the row-major order taking value k % per_block of block
+// k / per_block.
+template <typename TN, class S, class Gen>
+void fill_blocks(seoncore::matrix::DenseMatrix<TN, S>& M, const Philox4x32& rng, Gen gen)
+{
+    constexpr std::size_t V = per_block<TN>;
+    constexpr std::size_t B = fill_batch;
+
+    const std::size_t rows = M.rows();
+    const std::size_t cols = M.cols();
+    const bool row_major = (M.major() == seoncore::enums::Major::Row);
+    TN* p = M.data();
+
+    seoncore::parallel::parallel_for(rows * cols, fill_grain, [&](std::size_t lo, std::size_t hi)
+    {
+        std::array<std::array<std::uint32_t, B>, 4> bits;
+        std::array<TN, B * V> vals;
+
+        for (std::size_t first = lo / V; first * V < hi; first += B)
+        {
+            rng.blocks<B>(first, bits);
+            for (std::size_t i = 0; i < B; ++i)
+                gen(bits[0][i], bits[1][i], bits[2][i], bits[3][i], &vals[i * V]);
+
+            const std::size_t base = first * V;
+            const std::size_t k0 = std::max(lo, base);
+            const std::size_t k1 = std::min(hi, base + B * V);
+
+            if (row_major)
+                std::copy(vals.begin() + (k0 - base), vals.begin() + (k1 - base), p + k0);
+            else
+                for (std::size_t k = k0; k < k1; ++k)
+                    p[(k % cols) * rows + k / cols] = vals[k - base];
+        };
+    });
+};
+
+}; // namespace detail
+
+// Fills M with values uniform on [lo, hi).
+template <std::floating_point TN, class S>
+void fill_uniform(
+    seoncore::matrix::DenseMatrix<TN, S>& M,
+    std::uint64_t seed,
+    TN lo = TN{0},
+    TN hi = TN{1},
+    std::uint64_t stream = 0)
+{
+    SEONCORE_OP_SCOPE("random_uniform", seoncore::enums::Path::Direct, M.rows(), M.cols(), 0, 0,
+                      M.rows() * M.cols() * sizeof(TN));
+
+    assert(lo <= hi);
+
+    // lo + scale * u rounds up to hi when hi is coarse next to scale (e.g.
+    // [2^20, 2^20 + 1) in float), so results are capped below it.
+    const TN scale = hi - lo;
+    const TN top = std::nextafter(hi, lo);
+    auto draw = [lo, scale, top](TN u) { return std::min(lo + scale * u, top); };
+
+    detail::fill_blocks(M, Philox4x32(seed, stream),
+        [draw](std::uint32_t x0, std::uint32_t x1, std::uint32_t x2, std::uint32_t x3, TN* out)
+        {
+            if constexpr (detail::per_block<TN> == 4)
+            {
+                out[0] = draw(detail::unit<TN>(x0));
+                out[1] = draw(detail::unit<TN>(x1));
+                out[2] = draw(detail::unit<TN>(x2));
+                out[3] = draw(detail::unit<TN>(x3));
+            }
+            else
+            {
+                out[0] = draw(detail::unit<TN>(x0, x1));
+                out[1] = draw(detail::unit<TN>(x2, x3));
+            };
+        });
+};
+
+// Fills M with normal values of the given mean and standard deviation
+// (Box-Muller on pairs of uniforms from the same block).
+template <std::floating_point TN, class S>
+void fill_normal(
+    seoncore::matrix::DenseMatrix<TN, S>& M,
+    std::uint64_t seed,
+    TN mean = TN{0},
+    TN stddev = TN{1},
+    std::uint64_t stream = 0)
+{
+    SEONCORE_OP_SCOPE("random_normal", seoncore::enums::Path::Direct, M.rows(), M.cols(), 0, 0,
+                      M.rows() * M.cols() * sizeof(TN));
+
+    // u1 is taken from (0, 1] so the logarithm stays finite.
+    auto pair = [mean, stddev](TN u1, TN u2, TN* out)
+    {
+        const TN r = stddev * std::sqrt(TN{-2} * std::log(TN{1} - u1));
+        const TN t = TN{2} * std::numbers::pi_v<TN> * u2;
+        out[0] = mean + r * std::cos(t);
+        out[1] = mean + r * std::sin(t);
+    };
+
+    detail::fill_blocks(M, Philox4x32(seed, stream),
+        [pair](std::uint32_t x0, std::uint32_t x1, std::uint32_t x2, std::uint32_t x3, TN* out)
+        {
+            if constexpr (detail::per_block<TN> == 4)
+            {
+                pair(detail::unit<TN>(x0), detail::unit<TN>(x1), out);
+                pair(detail::unit<TN>(x2), detail::unit<TN>(x3), out + 2);
+            }
+            else
+                pair(detail::unit<TN>(x0, x1), detail::unit<TN>(x2, x3), out);
+        });
+};
+
+template <std::floating_point TN, class Storage = std::vector<TN>>
+seoncore::matrix::DenseMatrix<TN, Storage> random_uniform(
+    std::size_t rows,
+    std::size_t cols,
+    std::uint64_t seed,
+    TN lo = TN{0},
+    TN hi = TN{1},
+    seoncore::enums::Major major = seoncore::enums::Major::Row)
+{
+    seoncore::matrix::DenseMatrix<TN, Storage> M(rows, cols, major);
+    fill_uniform(M, seed, lo, hi);
+    return M;
+};
+
+template <std::floating_point TN, class Storage = std::vector<TN>>
+seoncore::matrix::DenseMatrix<TN, Storage> random_normal(
+    std::size_t rows,
+    std::size_t cols,
+    std::uint64_t seed,
+    TN mean = TN{0},
+    TN stddev = TN{1},
+    seoncore::enums::Major major = seoncore::enums::Major::Row)
+{
+    seoncore::matrix::DenseMatrix<TN, Storage> M(rows, cols, major);
+    fill_normal(M, seed, mean, stddev);
+    return M;
+};
+
+}; // namespace seoncore::random
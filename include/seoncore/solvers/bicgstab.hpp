@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/solvers/solver.hpp>
+#include <seoncore/solvers/preconditioners.hpp>
+
+namespace seoncore::solvers
+{
+
+// Right-preconditioned BiCGSTAB for general nonsymmetric A. Stops early
+// without convergence on the usual breakdowns (rho == 0 or omega == 0).
+template <typename TN>
+class BiCGSTAB
+{
+public:
+    using vec_view      = seoncore::views::VectorView<TN>;
+    using mut_vec_view  = seoncore::views::MutableVectorView<TN>;
+
+    explicit BiCGSTAB(std::size_t n, SolverOptions opts = {})
+        : _opts(opts)
+        , _r(n)
+        , _r0(n)
+        , _p(n)
+        , _v(n)
+        , _s(n)
+        , _t(n)
+        , _ph(n)
+        , _sh(n)
+    {};
+
+    template <LinearOperator<TN> Op, class Prec = IdentityPreconditioner<TN>>
+    SolverStats solve(const Op& A, vec_view b, mut_vec_view x, const Prec& M = {})
+    {
+        assert(b.size() == _r.size());
+        assert(x.size() == _r.size());
+
+        using seoncore::ops::dot;
+        using seoncore::ops::nrm2;
+        using seoncore::ops::axpy;
+        using seoncore::ops::xpby;
+
+        const std::size_t n = _r.size();
+        mut_vec_view r(_r.data(), n, 1);
+        mut_vec_view r0(_r0.data(), n, 1);
+        mut_vec_view p(_p.data(), n, 1);
+        mut_vec_view v(_v.data(), n, 1);
+        mut_vec_view s(_s.data(), n, 1);
+        mut_vec_view t(_t.data(), n, 1);
+        mut_vec_view ph(_ph.data(), n, 1);
+        mut_vec_view sh(_sh.data(), n, 1);
+
+        SolverStats stats;
+        const double b_norm = static_cast<double>(nrm2(b));
+        const double target = residual_target(_opts, b_norm);
+
+        apply<TN>(A, x, t);
+        seoncore::ops::copy(b, r);
+        axpy(TN{-1}, vec_view(t), r);
+
+        double r_norm = static_cast<double>(nrm2(vec_view(r)));
+        record(stats, r_norm, b_norm);
+        if (r_norm <= target)
+        {
+            stats.converged = true;
+            return stats;
+        };
+
+        seoncore::ops::copy(vec_view(r), r0);
+        seoncore::ops::fill(p, TN{0});
+        seoncore::ops::fill(v, TN{0});
+
+        TN rho{1}, alpha{1}, omega{1};
+
+        while (stats.iterations < _opts.max_iterations)
+        {
+            const TN rho_next = dot(r0, r);
+            if (rho_next == TN{0}) break;
+
+            // p = r + beta * (p - omega * v)
+            const TN beta = (rho_next / rho) * (alpha / omega);
+            axpy(-omega, vec_view(v), p);
+            xpby(vec_view(r), beta, p);
+
+            M.apply(p, ph);
+            apply<TN>(A, ph, v);
+
+            const TN r0v = dot(r0, v);
+            if (r0v == TN{0}) break;
+            alpha = rho_next / r0v;
+
+            // s = r - alpha * v
+            seoncore::ops::copy(vec_view(r), s);
+            axpy(-alpha, vec_view(v), s);
+            ++stats.iterations;
+
+            const double s_norm = static_cast<double>(nrm2(vec_view(s)));
+            if (s_norm <= target)
+            {
+                axpy(alpha, vec_view(ph), x);
+                record(stats, s_norm, b_norm);
+                stats.converged = true;
+                break;
+            };
+
+            M.apply(s, sh);
+            apply<TN>(A, sh, t);
+
+            const TN tt = dot(t, t);
+            omega = (tt != TN{0}) ? dot(t, s) / tt : TN{0};
+
+            axpy(alpha, vec_view(ph), x);
+            axpy(omega, vec_view(sh), x);
+
+            // r = s - omega * t
+            seoncore::ops::copy(vec_view(s), r);
+            axpy(-omega, vec_view(t), r);
+
+            r_norm = static_cast<double>(nrm2(vec_view(r)));
+            record(stats, r_norm, b_norm);
+            if (r_norm <= target)
+            {
+                stats.converged = true;
+                break;
+            };
+
+            if (omega == TN{0}) break;
+            rho = rho_next;
+        };
+
+        return stats;
+    };
+
+    const SolverOptions& options() const noexcept { return _opts; };
+    SolverOptions& options() noexcept { return _opts; };
+
+private:
+    SolverOptions   _opts;
+    std::vector<TN> _r;
+    std::vector<TN> _r0;
+    std::vector<TN> _p;
+    std::vector<TN> _v;
+    std::vector<TN> _s;
+    std::vector<TN> _t;
+    std::vector<TN> _ph;
+    std::vector<TN> _sh;
+
+}; // class BiCGSTAB<TN>
+
+template <typename TN, LinearOperator<TN> Op, class Prec = IdentityPreconditioner<TN>>
+SolverStats bicgstab(
+    const Op& A,
+    seoncore::views::VectorView<TN> b,
+    seoncore::views::MutableVectorView<TN> x,
+    const Prec& M = {},
+    SolverOptions opts = {})
+{
+    return BiCGSTAB<TN>(b.size(), opts).solve(A, b, x, M);
+};
+
+}; // namespace seoncore::solvers
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/solvers/solver.hpp>
+#include <seoncore/solvers/preconditioners.hpp>
+
+namespace seoncore::solvers
+{
+
+// Preconditioned conjugate gradient for symmetric positive definite A.
+// The workspace is sized once in the constructor; `solve` does not
+// allocate, so one instance can be reused across many right-hand sides.
+template <typename TN>
+class ConjugateGradient
+{
+public:
+    using vec_view      = seoncore::views::VectorView<TN>;
+    using mut_vec_view  = seoncore::views::MutableVectorView<TN>;
+
+    explicit ConjugateGradient(std::size_t n, SolverOptions opts = {})
+        : _opts(opts)
+        , _r(n)
+        , _z(n)
+        , _p(n)
+        , _q(n)
+    {};
+
+    template <LinearOperator<TN> Op, class Prec = IdentityPreconditioner<TN>>
+    SolverStats solve(const Op& A, vec_view b, mut_vec_view x, const Prec& M = {})
+    {
+        assert(b.size() == _r.size());
+        assert(x.size() == _r.size());
+
+        using seoncore::ops::dot;
+        using seoncore::ops::nrm2;
+        using seoncore::ops::axpy;
+        using seoncore::ops::xpby;
+
+        const std::size_t n = _r.size();
+        mut_vec_view r(_r.data(), n, 1);
+        mut_vec_view z(_z.data(), n, 1);
+        mut_vec_view p(_p.data(), n, 1);
+        mut_vec_view q(_q.data(), n, 1);
+
+        SolverStats stats;
+        const double b_norm = static_cast<double>(nrm2(b));
+        const double target = residual_target(_opts, b_norm);
+
+        // r = b - A x
+        apply<TN>(A, x, q);
+        seoncore::ops::copy(b, r);
+        axpy(TN{-1}, vec_view(q), r);
+
+        double r_norm = static_cast<double>(nrm2(vec_view(r)));
+        record(stats, r_norm, b_norm);
+        if (r_norm <= target)
+        {
+            stats.converged = true;
+            return stats;
+        };
+
+        M.apply(r, z);
+        seoncore::ops::copy(vec_view(z), p);
+        TN rz = dot(r, z);
+
+        while (stats.iterations < _opts.max_iterations)
+        {
+            apply<TN>(A, p, q);
+
+            const TN pq = dot(p, q);
+            if (pq == TN{0}) break;
+
+            const TN alpha = rz / pq;
+            axpy(alpha, vec_view(p), x);
+            axpy(-alpha, vec_view(q), r);
+            ++stats.iterations;
+
+            r_norm = static_cast<double>(nrm2(vec_view(r)));
+            record(stats, r_norm, b_norm);
+            if (r_norm <= target)
+            {
+                stats.converged = true;
+                break;
+            };
+
+            M.apply(r, z);
+            const TN rz_next = dot(r, z);
+            xpby(vec_view(z), rz_next / rz, p);
+            rz = rz_next;
+        };
+
+        return stats;
+    };
+
+    const SolverOptions& options() const noexcept { return _opts; };
+    SolverOptions& options() noexcept { return _opts; };
+
+private:
+    SolverOptions   _opts;
+    std::vector<TN> _r;
+    std::vector<TN> _z;
+    std::vector<TN> _p;
+    std::vector<TN> _q;
+
+}; // class ConjugateGradient<TN>
+
+template <typename TN, LinearOperator<TN> Op, class Prec = IdentityPreconditioner<TN>>
+SolverStats cg(
+    const Op& A,
+    seoncore::views::VectorView<TN> b,
+    seoncore::views::MutableVectorView<TN> x,
+    const Prec& M = {},
+    SolverOptions opts = {})
+{
+    return ConjugateGradient<TN>(b.size(), opts).solve(A, b, x, M);
+};
+
+}; // namespace seoncore::solvers
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/solvers/solver.hpp>
+#include <seoncore/solvers/preconditioners.hpp>
+
+namespace seoncore::solvers
+{
+
+// Restarted, right-preconditioned GMRES(m) with modified Gram-Schmidt and
+// Givens rotations. m is `SolverOptions::restart`; the Krylov basis takes
+// (m + 1) * n elements and is allocated once in the constructor.
+template <typename TN>
+class GMRES
+{
+public:
+    using vec_view      = seoncore::views::VectorView<TN>;
+    using mut_vec_view  = seoncore::views::MutableVectorView<TN>;
+
+    explicit GMRES(std::size_t n, SolverOptions opts = {})
+        : _opts(opts)
+        , _n(n)
+        , _m(std::max<std::size_t>(1, opts.restart))
+        , _V((_m + 1) * n)
+        , _H((_m + 1) * _m)
+        , _cs(_m)
+        , _sn(_m)
+        , _g(_m + 1)
+        , _y(_m)
+        , _w(n)
+        , _z(n)
+    {};
+
+    template <LinearOperator<TN> Op, class Prec = IdentityPreconditioner<TN>>
+    SolverStats solve(const Op& A, vec_view b, mut_vec_view x, const Prec& M = {})
+    {
+        assert(b.size() == _n);
+        assert(x.size() == _n);
+
+        using std::abs;
+        using std::sqrt;
+        using seoncore::ops::dot;
+        using seoncore::ops::nrm2;
+        using seoncore::ops::axpy;
+
+        mut_vec_view w(_w.data(), _n, 1);
+        mut_vec_view z(_z.data(), _n, 1);
+
+        SolverStats stats;
+        const double b_norm = static_cast<double>(nrm2(b));
+        const double target = residual_target(_opts, b_norm);
+
+        for (;;)
+        {
+            // r = b - A x, stored straight into V_0
+            mut_vec_view v0 = _basis(0);
+            apply<TN>(A, x, w);
+            seoncore::ops::copy(b, v0);
+            axpy(TN{-1}, vec_view(w), v0);
+
+            const TN beta = nrm2(vec_view(v0));
+            record(stats, static_cast<double>(beta), b_norm);
+
+            if (static_cast<double>(beta) <= target)
+            {
+                stats.converged = true;
+                break;
+            };
+            if (stats.iterations >= _opts.max_iterations) break;
+
+            seoncore::ops::scal(TN{1} / beta, v0);
+            std::fill(_g.begin(), _g.end(), TN{0});
+            _g[0] = beta;
+
+            std::size_t k = 0;
+            while (k < _m && stats.iterations < _opts.max_iterations)
+            {
+                M.apply(_basis(k), z);
+                apply<TN>(A, z, w);
+
+                for (std::size_t i = 0; i <= k; ++i)
+                {
+                    const TN hik = dot(vec_view(w), vec_view(_basis(i)));
+                    _h(i, k) = hik;
+                    axpy(-hik, vec_view(_basis(i)), w);
+                };
+
+                const TN hnext = nrm2(vec_view(w));
+                _h(k + 1, k) = hnext;
+                if (hnext != TN{0})
+                {
+                    seoncore::ops::copy(vec_view(w), _basis(k + 1));
+                    seoncore::ops::scal(TN{1} / hnext, _basis(k + 1));
+                };
+
+                for (std::size_t i = 0; i < k; ++i)
+                {
+                    const TN a = _h(i, k);
+                    const TN c = _h(i + 1, k);
+                    _h(i, k)     =  _cs[i] * a + _sn[i] * c;
+                    _h(i + 1, k) = -_sn[i] * a + _cs[i] * c;
+                };
+
+                const TN a = _h(k, k);
+                const TN c = _h(k + 1, k);
+                const TN den = sqrt(a * a + c * c);
+                _cs[k] = (den != TN{0}) ? a / den : TN{1};
+                _sn[k] = (den != TN{0}) ? c / den : TN{0};
+                _h(k, k)     = den;
+                _h(k + 1, k) = TN{0};
+
+                _g[k + 1] = -_sn[k] * _g[k];
+                _g[k]     =  _cs[k] * _g[k];
+
+                ++k;
+                ++stats.iterations;
+
+                const double res = static_cast<double>(abs(_g[k]));
+                record(stats, res, b_norm);
+                if (res <= target || hnext == TN{0}) break;
+            };
+
+            // y = H(0:k, 0:k) \ g(0:k), then x += M^-1 (V y)
+            for (std::size_t i = k; i-- > 0;)
+            {
+                TN acc = _g[i];
+                for (std::size_t j = i + 1; j < k; ++j)
+                    acc -= _h(i, j) * _y[j];
+                _y[i] = (_h(i, i) != TN{0}) ? acc / _h(i, i) : TN{0};
+            };
+
+            seoncore::ops::fill(w, TN{0});
+            for (std::size_t i = 0; i < k; ++i)
+                axpy(_y[i], vec_view(_basis(i)), w);
+
+            M.apply(w, z);
+            axpy(TN{1}, vec_view(z), x);
+        };
+
+        return stats;
+    };
+
+    const SolverOptions& options() const noexcept { return _opts; };
+
+private:
+    SolverOptions   _opts;
+    std::size_t     _n;
+    std::size_t     _m;
+    std::vector<TN> _V;     // basis vectors, each contiguous
+    std::vector<TN> _H;     // (m + 1) x m Hessenberg, row-major
+    std::vector<TN> _cs;
+    std::vector<TN> _sn;
+    std::vector<TN> _g;
+    std::vector<TN> _y;
+    std::vector<TN> _w;
+    std::vector<TN> _z;
+
+    mut_vec_view _basis(std::size_t i) noexcept { return mut_vec_view(_V.data() + i * _n, _n, 1); };
+
+    TN& _h(std::size_t i, std::size_t j) noexcept { return _H[i * _m + j]; };
+
+}; // class GMRES<TN>
+
+template <typename TN, LinearOperator<TN> Op, class Prec = IdentityPreconditioner<TN>>
+SolverStats gmres(
+    const Op& A,
+    seoncore::views::VectorView<TN> b,
+    seoncore::views::MutableVectorView<TN> x,
+    const Prec& M = {},
+    SolverOptions opts = {})
+{
+    return GMRES<TN>(b.size(), opts).solve(A, b, x, M);
+};
+
+}; // namespace seoncore::solvers
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::solvers
+{
+
+// Preconditioners expose `apply(r, z)`, writing z = M^-1 * r.
+
+template <typename TN>
+struct IdentityPreconditioner
+{
+    void apply(
+        seoncore::views::VectorView<TN> r,
+        seoncore::views::MutableVectorView<TN> z) const
+    {
+        seoncore::ops::copy(r, z);
+    };
+};
+
+template <typename TN>
+class JacobiPreconditioner
+{
+public:
+    JacobiPreconditioner() = default;
+
+    template <seoncore::concepts::MatrixLike A>
+    explicit JacobiPreconditioner(const A& a)
+        : _inv_diag(a.rows())
+    {
+        assert(a.rows() == a.cols());
+
+        for (std::size_t i = 0; i < a.rows(); ++i)
+        {
+            const TN d = a(i, i);
+            _inv_diag[i] = (d != TN{0}) ? TN{1} / d : TN{1};
+        };
+    };
+
+    void apply(
+        seoncore::views::VectorView<TN> r,
+        seoncore::views::MutableVectorView<TN> z) const
+    {
+        assert(r.size() == _inv_diag.size());
+        assert(z.size() == _inv_diag.size());
+
+        seoncore::parallel::parallel_for(r.size(), seoncore::ops::blas1_grain, [&](std::size_t lo, std::size_t hi)
+        {
+            for (std::size_t i = lo; i < hi; ++i)
+                z[i] = _inv_diag[i] * r[i];
+        });
+    };
+
+private:
+    std::vector<TN> _inv_diag;
+
+}; // class JacobiPreconditioner<TN>
+
+// Incomplete LU with zero fill-in. The sparsity pattern is the set of
+// nonzero entries of A (plus the diagonal), kept in CSR form; L has an
+// implicit unit diagonal and shares the arrays with U. Applying it is a
+// forward and a backward sparse triangular solve, which are inherently
+// sequential and run on the calling thread.
+template <typename TN>
+class ILU0Preconditioner
+{
+public:
+    ILU0Preconditioner() = default;
+
+    template <seoncore::concepts::MatrixLike A>
+    explicit ILU0Preconditioner(const A& a)
+    {
+        assert(a.rows() == a.cols());
+
+        const std::size_t n = a.rows();
+        _row_ptr.assign(n + 1, 0);
+        _diag.assign(n, 0);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                const TN v = a(i, j);
+                if (v == TN{0} && i != j) continue;
+
+                if (i == j) _diag[i] = _cols.size();
+                _cols.push_back(j);
+                _vals.push_back(v);
+            };
+            _row_ptr[i + 1] = _cols.size();
+        };
+
+        _factor();
+    };
+
+    void apply(
+        seoncore::views::VectorView<TN> r,
+        seoncore::views::MutableVectorView<TN> z) const
+    {
+        const std::size_t n = _diag.size();
+        assert(r.size() == n);
+        assert(z.size() == n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            TN acc = r[i];
+            for (std::size_t p = _row_ptr[i]; p < _diag[i]; ++p)
+                acc -= _vals[p] * z[_cols[p]];
+            z[i] = acc;
+        };
+
+        for (std::size_t i = n; i-- > 0;)
+        {
+            TN acc = z[i];
+            for (std::size_t p = _diag[i] + 1; p < _row_ptr[i + 1]; ++p)
+                acc -= _vals[p] * z[_cols[p]];
+            z[i] = acc / _vals[_diag[i]];
+        };
+    };
+
+    std::size_t nonzeros() const noexcept { return _vals.size(); };
+
+private:
+    std::vector<std::size_t>    _row_ptr;
+    std::vector<std::size_t>    _cols;
+    std::vector<std::size_t>    _diag;
+    std::vector<TN>             _vals;
+
+    // IKJ-ordered elimination restricted to the existing pattern.
+    void _factor()
+    {
+        const std::size_t n = _diag.size();
+        constexpr std::size_t none = static_cast<std::size_t>(-1);
+        std::vector<std::size_t> pos(n, none);
+
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            for (std::size_t p = _row_ptr[i]; p < _row_ptr[i + 1]; ++p)
+                pos[_cols[p]] = p;
+
+            for (std::size_t p = _row_ptr[i]; p < _diag[i]; ++p)
+            {
+                const std::size_t k = _cols[p];
+                const TN ukk = _vals[_diag[k]];
+                if (ukk == TN{0}) continue;
+
+                _vals[p] /= ukk;
+                const TN lik = _vals[p];
+
+                for (std::size_t q = _diag[k] + 1; q < _row_ptr[k + 1]; ++q)
+                {
+                    const std::size_t at = pos[_cols[q]];
+                    if (at != none) _vals[at] -= lik * _vals[q];
+                };
+            };
+
+            for (std::size_t p = _row_ptr[i]; p < _row_ptr[i + 1]; ++p)
+                pos[_cols[p]] = none;
+        };
+    };
+
+}; // class ILU0Preconditioner<TN>
+
+}; // namespace seoncore::solvers
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <seoncore/concepts/matrix_like.hpp>
+#include <seoncore/views/vec.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+namespace seoncore::solvers
+{
+
+struct SolverOptions
+{
+    std::size_t max_iterations  = 1000;
+    double      rtol            = 1e-8;     // relative to ||b||
+    double      atol            = 0.0;
+    std::size_t restart         = 30;       // GMRES only
+};
+
+struct SolverStats
+{
+    std::size_t iterations          = 0;
+    double      residual_norm       = 0.0;
+    double      relative_residual   = 0.0;
+    bool        converged           = false;
+};
+
+// A linear operator is either a matrix (anything MatrixLike) or a callable
+// `op(x, y)` that writes y = A * x. The callable form lets implicitly
+// defined systems be solved without ever forming A.
+template <class Op, typename TN>
+concept CallableOperator =
+std::invocable<const Op&, seoncore::views::VectorView<TN>, seoncore::views::MutableVectorView<TN>>;
+
+template <class Op, typename TN>
+concept LinearOperator = CallableOperator<Op, TN> || seoncore::concepts::MatrixLike<Op>;
+
+// y = A * x
+template <typename TN, LinearOperator<TN> Op>
+void apply(
+    const Op& A,
+    seoncore::views::VectorView<TN> x,
+    seoncore::views::MutableVectorView<TN> y)
+{
+    if constexpr (CallableOperator<Op, TN>)
+    {
+        A(x, y);
+    }
+    else
+    {
+        assert(A.cols() == x.size());
+        assert(A.rows() == y.size());
+
+        const std::size_t cols = A.cols();
+        const std::size_t grain = std::max<std::size_t>(1, seoncore::ops::blas1_grain / std::max<std::size_t>(1, cols));
+
+        seoncore::parallel::parallel_for(A.rows(), grain, [&](std::size_t lo, std::size_t hi)
+        {
+            for (std::size_t i = lo; i < hi; ++i)
+            {
+                TN acc{};
+                for (std::size_t j = 0; j < cols; ++j)
+                    acc += A(i, j) * x[j];
+                y[i] = acc;
+            };
+        });
+    };
+};
+
+// Shared stopping rule: ||r|| <= max(rtol * ||b||, atol).
+inline double residual_target(const SolverOptions& opts, double b_norm) noexcept
+{
+    return std::max(opts.rtol * b_norm, opts.atol);
+};
+
+inline void record(SolverStats& stats, double r_norm, double b_norm) noexcept
+{
+    stats.residual_norm = r_norm;
+    stats.relative_residual = (b_norm > 0.0) ? r_norm / b_norm : r_norm;
+};
+
+}; // namespace seoncore::solvers
@@ -0,0 +1,6 @@
+#pragma once
+#include <seoncore/solvers/solver.hpp>
+#include <seoncore/solvers/preconditioners.hpp>
+#include <seoncore/solvers/cg.hpp>
+#include <seoncore/solvers/bicgstab.hpp>
+#include <seoncore/solvers/gmres.hpp>
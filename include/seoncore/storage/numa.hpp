@@ -0,0 +1,214 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <seoncore/parallel/numa.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace seoncore::storage
+{
+
+// Where the pages of a NumaStorage block end up.
+enum class NumaPlacement
+{
+    FirstTouch,     // wherever the initializing thread runs, see below
+    Partitioned,    // block g of `nodes` contiguous blocks bound to node g
+    Interleave      // pages round-robin over all nodes
+};
+
+// Element buffer whose initialization (zero-fill, copy) runs through
+// parallel_for_local, so element range g * n / nodes .. (g + 1) * n / nodes
+// is first touched by threads of node g. Kernels that split work the same
+// way (GEMM's row blocks, anything on parallel_for_local) then find their
+// part of a row-major matrix in local memory. Partitioned and Interleave
+// additionally pin the pages with an explicit memory policy. Large blocks
+// are mapped straight from the kernel so that no page has been touched
+// before the policy and the parallel fill apply.
+template <typename TN, NumaPlacement P = NumaPlacement::FirstTouch>
+class NumaStorage
+{
+public:
+    using value_type        = TN;
+    using size_type         = std::size_t;
+    using reference         = TN&;
+    using const_ref         = const TN&;
+    using pointer           = TN*;
+    using const_ptr         = const TN*;
+
+    static constexpr NumaPlacement placement = P;
+
+    NumaStorage() noexcept = default;
+
+    explicit NumaStorage(size_type n)
+    {
+        _p = _allocate(n);
+        _n = n;
+        _parallel(n, [this](size_type lo, size_type hi)
+        {
+            std::uninitialized_value_construct(_p + lo, _p + hi);
+        });
+    };
+
+    template <std::input_iterator It>
+    NumaStorage(It first, It last)
+    {
+        if constexpr (std::random_access_iterator<It>)
+        {
+            const size_type n = static_cast<size_type>(std::distance(first, last));
+            _p = _allocate(n);
+            _n = n;
+            _parallel(n, [this, first](size_type lo, size_type hi)
+            {
+                std::uninitialized_copy(first + static_cast<std::ptrdiff_t>(lo),
+                                        first + static_cast<std::ptrdiff_t>(hi), _p + lo);
+            });
+        }
+        else
+        {
+            const std::vector<TN> tmp(first, last);
+            *this = NumaStorage(tmp.begin(), tmp.end());
+        };
+    };
+
+    NumaStorage(const NumaStorage& other)
+        : NumaStorage(other._p, other._p + other._n)
+    {};
+
+    NumaStorage& operator=(const NumaStorage& other)
+    {
+        if (this == &other) return *this;
+
+        NumaStorage tmp(other);
+        *this = std::move(tmp);
+
+        return *this;
+    };
+
+    NumaStorage(NumaStorage&& other) noexcept
+        : _p(std::exchange(other._p, nullptr))
+        , _n(std::exchange(other._n, 0))
+        , _mapped(std::exchange(other._mapped, false))
+    {};
+
+    NumaStorage& operator=(NumaStorage&& other) noexcept
+    {
+        if (this == &other) return *this;
+
+        _reset();
+        _p = std::exchange(other._p, nullptr);
+        _n = std::exchange(other._n, 0);
+        _mapped = std::exchange(other._mapped, false);
+
+        return *this;
+    };
+
+    ~NumaStorage() noexcept { _reset(); };
+
+    bool operator==(const NumaStorage& other) const noexcept
+    {
+        return _n == other._n && std::equal(_p, _p + _n, other._p);
+    };
+
+    size_type size() const noexcept { return _n; };
+
+    // True when the block came from mmap and is subject to the placement.
+    bool mapped() const noexcept { return _mapped; };
+
+    pointer data() noexcept { return _p; };
+    const_ptr data() const noexcept { return _p; };
+
+    reference operator[](size_type i) noexcept { return _p[i]; };
+    const_ref operator[](size_type i) const noexcept { return _p[i]; };
+
+private:
+    pointer     _p = nullptr;
+    size_type   _n = 0;
+    bool        _mapped = false;
+
+    // Below this a block is not worth a mapping of its own.
+    static constexpr size_type _map_threshold = size_type{1} << 16;
+
+    static size_type _grain() noexcept
+    {
+        return std::max<size_type>(1, 4 * seoncore::parallel::numa::page_size() / sizeof(TN));
+    };
+
+    template <class F>
+    static void _parallel(size_type n, F&& fn)
+    {
+        seoncore::parallel::parallel_for_local(n, _grain(), std::forward<F>(fn));
+    };
+
+    pointer _allocate(size_type n)
+    {
+        if (n == 0) return nullptr;
+
+        const size_type bytes = n * sizeof(TN);
+
+#if defined(__linux__)
+        if (bytes >= _map_threshold && alignof(TN) <= seoncore::parallel::numa::page_size())
+        {
+            void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p != MAP_FAILED)
+            {
+                _mapped = true;
+                _place(p, n);
+                return static_cast<pointer>(p);
+            };
+        };
+#endif
+        return std::allocator<TN>{}.allocate(n);
+    };
+
+    static void _place(void* p, size_type n) noexcept
+    {
+        namespace numa = seoncore::parallel::numa;
+
+        const numa::Topology& topo = seoncore::parallel::default_pool().topology();
+        if constexpr (P == NumaPlacement::Interleave)
+        {
+            std::vector<size_type> all(topo.node_count());
+            for (size_type g = 0; g < all.size(); ++g) all[g] = g;
+            numa::apply_policy(topo, p, n * sizeof(TN), numa::MemoryPolicy::Interleave, all);
+        }
+        else if constexpr (P == NumaPlacement::Partitioned)
+        {
+            const size_type groups = std::min(topo.node_count(), seoncore::parallel::ThreadPool::max_groups);
+            for (size_type g = 0; g < groups; ++g)
+            {
+                const size_type lo = g * n / groups;
+                const size_type hi = (g + 1) * n / groups;
+                numa::apply_policy(topo, static_cast<pointer>(p) + lo, (hi - lo) * sizeof(TN),
+                                   numa::MemoryPolicy::Bind, { g });
+            };
+        };
+    };
+
+    void _reset() noexcept
+    {
+        if (_p == nullptr) return;
+
+        std::destroy_n(_p, _n);
+#if defined(__linux__)
+        if (_mapped)
+            ::munmap(_p, _n * sizeof(TN));
+        else
+#endif
+            std::allocator<TN>{}.deallocate(_p, _n);
+
+        _p = nullptr;
+        _n = 0;
+        _mapped = false;
+    };
+
+}; // class NumaStorage<TN, P>
+
+}; // namespace seoncore::storage
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace seoncore::storage
+{
+
+// Reference-counted, copy-on-write element buffer. Copies share one block
+// and only bump an atomic counter; the first non-const access through a
+// copy whose block is shared clones the elements. Const access never
+// detaches, so read-only fan-out to many consumers is O(1) per copy.
+//
+// Every non-const data() or operator[] checks the count (one atomic load),
+// so code writing many elements takes data() once and writes through the
+// pointer: DenseMatrix's row/col/flatten views and the kernels that write
+// into a result's data() all do.
+//
+// As with any COW container, a non-const reference obtained before a later
+// copy is taken keeps pointing into the (then shared) block.
+template <typename TN>
+class SharedStorage
+{
+public:
+    using value_type        = TN;
+    using size_type         = std::size_t;
+    using reference         = TN&;
+    using const_ref         = const TN&;
+    using pointer           = TN*;
+    using const_ptr         = const TN*;
+
+    constexpr SharedStorage() noexcept
+        : _b(nullptr)
+    {};
+
+    explicit SharedStorage(size_type n)
+        : _b(n == 0 ? nullptr : new _block(std::vector<TN>(n)))
+    {};
+
+    template <std::input_iterator It>
+    SharedStorage(It first, It last)
+        : _b(first == last ? nullptr : new _block(std::vector<TN>(first, last)))
+    {};
+
+    SharedStorage(const SharedStorage& other) noexcept
+        : _b(other._b)
+    {
+        _acquire();
+    };
+
+    SharedStorage& operator=(const SharedStorage& other) noexcept
+    {
+        if (_b == other._b) return *this;
+
+        _release();
+        _b = other._b;
+        _acquire();
+
+        return *this;
+    };
+
+    SharedStorage(SharedStorage&& other) noexcept
+        : _b(std::exchange(other._b, nullptr))
+    {};
+
+    SharedStorage& operator=(SharedStorage&& other) noexcept
+    {
+        if (this == &other) return *this;
+
+        _release();
+        _b = std::exchange(other._b, nullptr);
+
+        return *this;
+    };
+
+    ~SharedStorage() noexcept { _release(); };
+
+    bool operator==(const SharedStorage& other) const noexcept
+    {
+        if (_b == other._b) return true;
+        return size() == other.size() && std::equal(data(), data() + size(), other.data());
+    };
+
+    size_type size() const noexcept { return _b ? _b->buf.size() : 0; };
+
+    const_ptr data() const noexcept { return _b ? _b->buf.data() : nullptr; };
+    pointer data()
+    {
+        _detach();
+        return _b ? _b->buf.data() : nullptr;
+    };
+
+    const_ref operator[](size_type i) const noexcept { return _b->buf[i]; };
+    reference operator[](size_type i)
+    {
+        _detach();
+        return _b->buf[i];
+    };
+
+    // Number of storages sharing this buffer; 0 when empty.
+    size_type use_count() const noexcept
+    {
+        return _b ? _b->refs.load(std::memory_order_acquire) : 0;
+    };
+
+    bool unique() const noexcept { return use_count() <= 1; };
+
+private:
+    struct _block
+    {
+        explicit _block(std::vector<TN>&& b)
+            : refs(1)
+            , buf(std::move(b))
+        {};
+
+        std::atomic<size_type> refs;
+        std::vector<TN>        buf;
+    };
+
+    _block* _b;
+
+    void _acquire() noexcept
+    {
+        if (_b) _b->refs.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    void _release() noexcept
+    {
+        if (_b && _b->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete _b;
+        _b = nullptr;
+    };
+
+    // Only the owner thread can observe refs == 1 for its own block and no
+    // other thread can obtain a new reference without going through this
+    // object, so the check-then-write below cannot race.
+    void _detach()
+    {
+        if (_b && _b->refs.load(std::memory_order_acquire) != 1)
+        {
+            _block* fresh = new _block(std::vector<TN>(_b->buf));
+            _release();
+            _b = fresh;
+        };
+    };
+
+}; // class SharedStorage<TN>
+
+}; // namespace seoncore::storage
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace seoncore::storage
+{
+
+// Element buffer with room for `N` elements inline. Sizes up to `N` never
+// touch the allocator; larger ones spill to a single heap block. The size is
+// fixed at construction, as it is for every DenseMatrix buffer.
+template <typename TN, std::size_t N = 64>
+class SmallStorage
+{
+    // A zero-length inline array is ill-formed; with no inline room at all,
+    // std::vector is the buffer to use.
+    static_assert(N > 0, "SmallStorage needs an inline capacity of at least one element");
+
+public:
+    using value_type        = TN;
+    using size_type         = std::size_t;
+    using reference         = TN&;
+    using const_ref         = const TN&;
+    using pointer           = TN*;
+    using const_ptr         = const TN*;
+
+    static constexpr size_type inline_capacity = N;
+
+    SmallStorage() noexcept
+        : _p(_inline_ptr())
+        , _n(0)
+    {};
+
+    explicit SmallStorage(size_type n)
+        : _p(_allocate(n))
+        , _n(n)
+    {
+        std::uninitialized_value_construct_n(_p, _n);
+    };
+
+    template <std::input_iterator It>
+    SmallStorage(It first, It last)
+        : SmallStorage()
+    {
+        if constexpr (std::forward_iterator<It>)
+        {
+            const size_type n = static_cast<size_type>(std::distance(first, last));
+            _p = _allocate(n);
+            std::uninitialized_copy(first, last, _p);
+            _n = n;
+        }
+        else
+        {
+            // Single pass: materialize first, then copy in.
+            const std::vector<TN> tmp(first, last);
+            _p = _allocate(tmp.size());
+            std::uninitialized_copy(tmp.begin(), tmp.end(), _p);
+            _n = tmp.size();
+        };
+    };
+
+    SmallStorage(const SmallStorage& other)
+        : _p(_allocate(other._n))
+        , _n(other._n)
+    {
+        std::uninitialized_copy_n(other._p, _n, _p);
+    };
+
+    SmallStorage& operator=(const SmallStorage& other)
+    {
+        if (this == &other) return *this;
+
+        SmallStorage tmp(other);
+        *this = std::move(tmp);
+
+        return *this;
+    };
+
+    SmallStorage(SmallStorage&& other) noexcept
+        : SmallStorage()
+    {
+        _steal(other);
+    };
+
+    SmallStorage& operator=(SmallStorage&& other) noexcept
+    {
+        if (this == &other) return *this;
+
+        _reset();
+        _steal(other);
+
+        return *this;
+    };
+
+    ~SmallStorage() noexcept { _reset(); };
+
+    bool operator==(const SmallStorage& other) const noexcept
+    {
+        return _n == other._n && std::equal(_p, _p + _n, other._p);
+    };
+
+    size_type size() const noexcept { return _n; };
+
+    // True while the elements live in the inline buffer.
+    bool is_inline() const noexcept { return _p == _inline_ptr(); };
+
+    pointer data() noexcept { return _p; };
+    const_ptr data() const noexcept { return _p; };
+
+    reference operator[](size_type i) noexcept { return _p[i]; };
+    const_ref operator[](size_type i) const noexcept { return _p[i]; };
+
+private:
+    alignas(TN) unsigned char _inline[N * sizeof(TN)];
+    pointer     _p;
+    size_type   _n;
+
+    pointer _inline_ptr() noexcept { return reinterpret_cast<pointer>(_inline); };
+    const_ptr _inline_ptr() const noexcept { return reinterpret_cast<const_ptr>(_inline); };
+
+    pointer _allocate(size_type n)
+    {
+        if (n <= N) return _inline_ptr();
+        return std::allocator<TN>{}.allocate(n);
+    };
+
+    void _reset() noexcept
+    {
+        std::destroy_n(_p, _n);
+        if (!is_inline())
+            std::allocator<TN>{}.deallocate(_p, _n);
+
+        _p = _inline_ptr();
+        _n = 0;
+    };
+
+    // Heap blocks change hands; inline elements have to be moved across.
+    void _steal(SmallStorage& other) noexcept
+    {
+        if (other.is_inline())
+        {
+            std::uninitialized_move_n(other._p, other._n, _p);
+            _n = other._n;
+            other._reset();
+        }
+        else
+        {
+            _p = std::exchange(other._p, other._inline_ptr());
+            _n = std::exchange(other._n, 0);
+        };
+    };
+
+}; // class SmallStorage<TN, N>
+
+}; // namespace seoncore::storage
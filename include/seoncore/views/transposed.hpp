@@ -61,6 +61,7 @@ public:
     constexpr bool operator!=(const BaseTransposedView& other) noexcept { return !(*this == other); };
 
     constexpr mat_ref base() noexcept { return _m; };
+    constexpr const matrix_type& base() const noexcept { return _m; };
 
 private:
     mat_ref _m;
@@ -73,9 +74,9 @@ private:
         return _m.at(j, i);
     };
 
-    constexpr reference at_impl(size_type i, size_type j) const noexcept
+    constexpr typename matrix_type::const_ref at_impl(size_type i, size_type j) const noexcept
     {
-        return _m.at(j, i);
+        return std::as_const(_m).at(j, i);
     };
 
     constexpr vec_view row_impl(size_type i) noexcept
@@ -40,6 +40,14 @@ public:
         };
     };
 
+    template <bool OtherConst>
+    requires (IsConst && !OtherConst)
+    constexpr BaseVectorView(const BaseVectorView<TN, OtherConst>& other) noexcept
+        : _data(other.data())
+        , _size(other.size())
+        , _stride(other.stride())
+    {};
+
     [[nodiscard]]
     constexpr pointer data() const noexcept { return _data; };
     [[nodiscard]]
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdio>
+
+namespace seoncore::tests
+{
+
+// Failed checks so far; main_test returns nonzero if any.
+inline int& failures() noexcept
+{
+    static int count = 0;
+    return count;
+};
+
+inline void check(bool ok, const char* expr, const char* file, int line) noexcept
+{
+    if (ok) return;
+    ++failures();
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+};
+
+}; // namespace seoncore::tests
+
+// Unlike assert, stays on under NDEBUG and keeps going after a failure.
+#define SEONCORE_CHECK(expr) ::seoncore::tests::check(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
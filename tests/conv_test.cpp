@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/conv.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Major;
+using seoncore::matrix::DenseMatrix;
+using seoncore::ops::ConvAlgorithm;
+using seoncore::ops::ConvMode;
+
+namespace
+{
+
+DenseMatrix<double> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng, Major major = Major::Row)
+{
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+    DenseMatrix<double> A(m, n, major);
+    for (double& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+struct Case
+{
+    std::size_t c, h, w, oc, kh, kw;
+    std::array<std::size_t, 2> stride, padding, dilation;
+    std::size_t oh, ow;     // expected output size, worked out by hand
+};
+
+// The definition, one output at a time:
+//   out(o, oy, ox) = sum w(o, c, ky, kx) x(c, oy*sy + ky*dy - py, ox*sx + kx*dx - px)
+// with x zero outside the image, and the filter flipped for Convolution.
+DenseMatrix<double> reference(const DenseMatrix<double>& x, const DenseMatrix<double>& w, const Case& t, ConvMode mode)
+{
+    DenseMatrix<double> out(t.oc, t.oh * t.ow);
+    for (std::size_t o = 0; o < t.oc; ++o)
+        for (std::size_t oy = 0; oy < t.oh; ++oy)
+            for (std::size_t ox = 0; ox < t.ow; ++ox)
+            {
+                double s = 0.0;
+                for (std::size_t ci = 0; ci < t.c; ++ci)
+                    for (std::size_t ky = 0; ky < t.kh; ++ky)
+                        for (std::size_t kx = 0; kx < t.kw; ++kx)
+                        {
+                            const long iy = static_cast<long>(oy * t.stride[0] + ky * t.dilation[0]) - static_cast<long>(t.padding[0]);
+                            const long ix = static_cast<long>(ox * t.stride[1] + kx * t.dilation[1]) - static_cast<long>(t.padding[1]);
+                            if (iy < 0 || ix < 0 || iy >= static_cast<long>(t.h) || ix >= static_cast<long>(t.w)) continue;
+
+                            const std::size_t fy = (mode == ConvMode::Convolution) ? t.kh - 1 - ky : ky;
+                            const std::size_t fx = (mode == ConvMode::Convolution) ? t.kw - 1 - kx : kx;
+                            s += w(o, (ci * t.kh + fy) * t.kw + fx) * x(ci, static_cast<std::size_t>(iy) * t.w + static_cast<std::size_t>(ix));
+                        };
+                out(o, oy * t.ow + ox) = s;
+            };
+    return out;
+};
+
+double max_diff(const DenseMatrix<double>& a, const DenseMatrix<double>& b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols()) return INFINITY;
+
+    double m = 0.0;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            m = std::max(m, std::fabs(a(i, j) - b(i, j)));
+    return m;
+};
+
+// Strided, padded and dilated 2-D cases, including one whose dilated
+// filter does not fit. Every algorithm and both modes must give the
+// definition, for inputs in either storage order.
+void conv2d_matches_definition()
+{
+    const Case cases[] = {
+        { 3, 11,  9,  5, 3, 2, { 2, 3 }, { 1, 2 }, { 2, 1 }, 5, 4 },
+        { 4,  8,  8, 40, 3, 3, { 1, 1 }, { 1, 1 }, { 1, 1 }, 8, 8 },
+        { 2,  7, 10, 33, 2, 5, { 3, 1 }, { 0, 3 }, { 3, 2 }, 2, 8 },
+        { 1,  5,  6,  9, 1, 1, { 2, 2 }, { 0, 0 }, { 1, 1 }, 3, 3 },
+        { 2,  3,  3,  4, 3, 3, { 1, 1 }, { 0, 0 }, { 2, 2 }, 0, 0 },
+    };
+
+    std::mt19937 rng(73);
+    for (const Case& t : cases)
+    {
+        SEONCORE_CHECK(seoncore::ops::conv_output_size(t.h, t.kh, t.stride[0], t.padding[0], t.dilation[0]) == t.oh);
+        SEONCORE_CHECK(seoncore::ops::conv_output_size(t.w, t.kw, t.stride[1], t.padding[1], t.dilation[1]) == t.ow);
+
+        for (const Major major : { Major::Row, Major::Column })
+        {
+            const DenseMatrix<double> x = random_matrix(t.c, t.h * t.w, rng, major);
+            const DenseMatrix<double> w = random_matrix(t.oc, t.c * t.kh * t.kw, rng);
+
+            for (const ConvMode mode : { ConvMode::Correlation, ConvMode::Convolution })
+            {
+                const DenseMatrix<double> ref = reference(x, w, t, mode);
+
+                for (const ConvAlgorithm algo : { ConvAlgorithm::Direct, ConvAlgorithm::ImplicitGemm, ConvAlgorithm::Auto })
+                {
+                    seoncore::ops::Conv2dOptions opts;
+                    opts.stride = t.stride;
+                    opts.padding = t.padding;
+                    opts.dilation = t.dilation;
+                    opts.mode = mode;
+                    opts.algorithm = algo;
+
+                    const DenseMatrix<double> out = seoncore::ops::conv2d(x, t.h, t.w, w, t.kh, t.kw, opts);
+                    SEONCORE_CHECK(out.rows() == t.oc && out.cols() == t.oh * t.ow);
+                    SEONCORE_CHECK(max_diff(out, ref) <= 1e-12);
+                };
+            };
+        };
+    };
+};
+
+// conv1d is conv2d over a single row; the same definition with kh = 1.
+void conv1d_matches_definition()
+{
+    const Case cases[] = {
+        { 2, 1, 17,  3, 1, 4, { 1, 3 }, { 0, 2 }, { 1, 2 }, 1, 5 },
+        { 3, 1, 10, 33, 1, 3, { 1, 1 }, { 0, 0 }, { 1, 1 }, 1, 8 },
+        { 1, 1,  9,  2, 1, 2, { 1, 4 }, { 0, 1 }, { 1, 5 }, 1, 2 },
+    };
+
+    std::mt19937 rng(79);
+    for (const Case& t : cases)
+    {
+        const DenseMatrix<double> x = random_matrix(t.c, t.w, rng);
+        const DenseMatrix<double> w = random_matrix(t.oc, t.c * t.kw, rng);
+
+        for (const ConvMode mode : { ConvMode::Correlation, ConvMode::Convolution })
+        {
+            const DenseMatrix<double> ref = reference(x, w, t, mode);
+
+            for (const ConvAlgorithm algo : { ConvAlgorithm::Direct, ConvAlgorithm::ImplicitGemm })
+            {
+                seoncore::ops::Conv1dOptions opts;
+                opts.stride = t.stride[1];
+                opts.padding = t.padding[1];
+                opts.dilation = t.dilation[1];
+                opts.mode = mode;
+                opts.algorithm = algo;
+
+                const DenseMatrix<double> out = seoncore::ops::conv1d(x, w, opts);
+                SEONCORE_CHECK(out.rows() == t.oc && out.cols() == t.ow);
+                SEONCORE_CHECK(max_diff(out, ref) <= 1e-12);
+            };
+        };
+    };
+};
+
+}; // namespace
+
+void conv_tests()
+{
+    conv2d_matches_definition();
+    conv1d_matches_definition();
+};
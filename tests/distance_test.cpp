@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/distance.hpp>
+#include "check.hpp"
+
+using seoncore::matrix::DenseMatrix;
+using seoncore::ops::DistanceMetric;
+
+namespace
+{
+
+// Small integers, so many points coincide and the squared distances are
+// exact in double on both the GEMM and the direct route.
+DenseMatrix<double> lattice(std::size_t m, std::size_t d, std::mt19937& rng)
+{
+    std::uniform_int_distribution<int> ud(-2, 2);
+    DenseMatrix<double> A(m, d);
+    for (double& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+double distance(const DenseMatrix<double>& a, std::size_t i, const DenseMatrix<double>& b, std::size_t j, DistanceMetric metric)
+{
+    double ab = 0.0, aa = 0.0, bb = 0.0, d2 = 0.0;
+    for (std::size_t p = 0; p < a.cols(); ++p)
+    {
+        ab += a(i, p) * b(j, p);
+        aa += a(i, p) * a(i, p);
+        bb += b(j, p) * b(j, p);
+        d2 += (a(i, p) - b(j, p)) * (a(i, p) - b(j, p));
+    };
+
+    switch (metric)
+    {
+        case DistanceMetric::SquaredEuclidean:  return d2;
+        case DistanceMetric::Euclidean:         return std::sqrt(d2);
+        case DistanceMetric::Cosine:            return (aa == 0.0 || bb == 0.0) ? 1.0 : 1.0 - ab / std::sqrt(aa * bb);
+    };
+    return 0.0;
+};
+
+// Every corpus row ranked for every query by (distance, index), cut to k.
+std::vector<std::vector<std::size_t>> brute_force(
+    const DenseMatrix<double>& a, const DenseMatrix<double>& b, std::size_t k, DistanceMetric metric)
+{
+    std::vector<std::vector<std::size_t>> out(a.rows());
+    for (std::size_t i = 0; i < a.rows(); ++i)
+    {
+        std::vector<double> dist(b.rows());
+        for (std::size_t j = 0; j < b.rows(); ++j) dist[j] = distance(a, i, b, j, metric);
+
+        std::vector<std::size_t> order(b.rows());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return dist[x] < dist[y]; });
+        order.resize(std::min(k, b.rows()));
+        out[i] = order;
+    };
+    return out;
+};
+
+// Exact distances on the lattice, with a query block and a corpus tile
+// boundary crossed, so indices must match the brute force one for one and
+// ties must go to the lower index. k past the corpus size is clamped.
+void knn_matches_brute_force()
+{
+    std::mt19937 rng(83);
+    const DenseMatrix<double> A = lattice(70, 3, rng);
+    const DenseMatrix<double> B = lattice(600, 3, rng);
+
+    for (const DistanceMetric metric : { DistanceMetric::SquaredEuclidean, DistanceMetric::Euclidean })
+        for (const std::size_t k : { 1, 7, 600, 650 })
+        {
+            const auto r = seoncore::ops::knn(A, B, k, metric);
+            const auto want = brute_force(A, B, k, metric);
+            const std::size_t kk = std::min<std::size_t>(k, B.rows());
+
+            SEONCORE_CHECK(r.indices.rows() == A.rows() && r.indices.cols() == kk);
+            SEONCORE_CHECK(r.distances.rows() == A.rows() && r.distances.cols() == kk);
+
+            std::size_t wrong = 0;
+            for (std::size_t i = 0; i < A.rows(); ++i)
+                for (std::size_t t = 0; t < kk; ++t)
+                {
+                    wrong += r.indices(i, t) != want[i][t];
+                    wrong += r.distances(i, t) != distance(A, i, B, want[i][t], metric);
+                };
+            SEONCORE_CHECK(wrong == 0);
+        };
+
+    // Transposed views are accepted for either operand.
+    DenseMatrix<double> Bt(B.cols(), B.rows());
+    for (std::size_t i = 0; i < B.rows(); ++i)
+        for (std::size_t p = 0; p < B.cols(); ++p)
+            Bt(p, i) = B(i, p);
+    const auto r = seoncore::ops::knn(A, Bt.transposed(), 5);
+    const auto want = brute_force(A, B, 5, DistanceMetric::Euclidean);
+    for (std::size_t i = 0; i < A.rows(); ++i)
+        SEONCORE_CHECK(std::equal(want[i].begin(), want[i].end(), &r.indices(i, 0)));
+};
+
+// Cosine, with a zero query row (distance 1 to everything, so the first k
+// indices) and a zero corpus row (distance 1 from every query).
+void knn_cosine_zero_rows()
+{
+    std::mt19937 rng(89);
+    std::normal_distribution<double> nd;
+    DenseMatrix<double> A(5, 4);
+    DenseMatrix<double> B(40, 4);
+    for (double& v : A.flatten()) v = nd(rng);
+    for (double& v : B.flatten()) v = nd(rng);
+    for (std::size_t p = 0; p < 4; ++p)
+    {
+        A(2, p) = 0.0;
+        B(17, p) = 0.0;
+    };
+
+    const std::size_t k = 40;
+    const auto r = seoncore::ops::knn(A, B, k, DistanceMetric::Cosine);
+    const auto want = brute_force(A, B, k, DistanceMetric::Cosine);
+
+    for (std::size_t t = 0; t < k; ++t)
+    {
+        SEONCORE_CHECK(r.indices(2, t) == t);
+        SEONCORE_CHECK(r.distances(2, t) == 1.0);
+    };
+
+    for (std::size_t i = 0; i < A.rows(); ++i)
+    {
+        if (i == 2) continue;
+
+        double err = 0.0;
+        for (std::size_t t = 0; t < k; ++t)
+        {
+            err = std::max(err, std::fabs(r.distances(i, t) - distance(A, i, B, want[i][t], DistanceMetric::Cosine)));
+            if (r.indices(i, t) == 17) SEONCORE_CHECK(r.distances(i, t) == 1.0);
+        };
+        SEONCORE_CHECK(err <= 1e-12);
+        SEONCORE_CHECK(std::is_sorted(&r.distances(i, 0), &r.distances(i, 0) + k));
+    };
+};
+
+// A NaN coordinate makes that corpus row's distances NaN; it ranks after
+// every finite distance and leaves the others in order.
+void knn_nan_ranks_last()
+{
+    std::mt19937 rng(97);
+    DenseMatrix<double> B = lattice(30, 3, rng);
+    const DenseMatrix<double> A = lattice(4, 3, rng);
+    B(5, 1) = std::numeric_limits<double>::quiet_NaN();
+    B(21, 0) = std::numeric_limits<double>::quiet_NaN();
+
+    const auto r = seoncore::ops::knn(A, B, 30, DistanceMetric::SquaredEuclidean);
+    for (std::size_t i = 0; i < A.rows(); ++i)
+    {
+        SEONCORE_CHECK(r.indices(i, 28) == 5 && r.indices(i, 29) == 21);
+        SEONCORE_CHECK(std::is_sorted(&r.distances(i, 0), &r.distances(i, 0) + 28));
+    };
+};
+
+}; // namespace
+
+void distance_tests()
+{
+    knn_matches_brute_force();
+    knn_cosine_zero_rows();
+    knn_nan_ranks_last();
+};
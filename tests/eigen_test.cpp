@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+#include <seoncore/linalg/linalg.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include "check.hpp"
+
+using seoncore::matrix::DenseMatrix;
+
+namespace
+{
+
+DenseMatrix<double> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng)
+{
+    std::normal_distribution<double> nd;
+    DenseMatrix<double> A(m, n);
+    for (double& v : A.flatten()) v = nd(rng);
+    return A;
+};
+
+// max |Q^T Q - I| over the first k columns of Q.
+double orthogonality(const DenseMatrix<double>& Q, std::size_t k)
+{
+    double m = 0.0;
+    for (std::size_t a = 0; a < k; ++a)
+        for (std::size_t b = 0; b < k; ++b)
+        {
+            double s = 0.0;
+            for (std::size_t i = 0; i < Q.rows(); ++i) s += Q(i, a) * Q(i, b);
+            m = std::max(m, std::fabs(s - (a == b ? 1.0 : 0.0)));
+        };
+    return m;
+};
+
+double max_abs(const DenseMatrix<double>& A)
+{
+    double m = 0.0;
+    for (std::size_t i = 0; i < A.rows(); ++i)
+        for (std::size_t j = 0; j < A.cols(); ++j)
+            m = std::max(m, std::fabs(A(i, j)));
+    return m;
+};
+
+// Q diag(lambda) Q^T with Q a Householder reflector, so the spectrum is
+// known exactly.
+DenseMatrix<double> with_spectrum(const std::vector<double>& lambda, std::mt19937& rng)
+{
+    const std::size_t n = lambda.size();
+    std::normal_distribution<double> nd;
+
+    std::vector<double> u(n);
+    double uu = 0.0;
+    for (double& v : u) { v = nd(rng); uu += v * v; };
+
+    DenseMatrix<double> Q(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+            Q(i, j) = (i == j ? 1.0 : 0.0) - 2.0 * u[i] * u[j] / uu;
+
+    DenseMatrix<double> A(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            double s = 0.0;
+            for (std::size_t k = 0; k < n; ++k) s += Q(i, k) * lambda[k] * Q(j, k);
+            A(i, j) = s;
+        };
+    return A;
+};
+
+// A V = V diag(values) with V orthogonal and the values ascending, and the
+// values-only solve agrees. Only the lower triangle of A may be read, so
+// the upper one is filled with garbage first.
+void check_eigh(DenseMatrix<double> A, double tol)
+{
+    const std::size_t n = A.rows();
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = i + 1; j < n; ++j)
+            A(i, j) = 1e300;
+
+    const auto eig = seoncore::linalg::eigh(A);
+    const auto vals = seoncore::linalg::eigh(A, false);
+    SEONCORE_CHECK(eig.values.size() == n && vals.values.size() == n);
+    SEONCORE_CHECK(eig.vectors.rows() == n && eig.vectors.cols() == n);
+    SEONCORE_CHECK(std::is_sorted(eig.values.begin(), eig.values.end()));
+
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j <= i; ++j)
+            scale = std::max(scale, std::fabs(A(i, j)));
+
+    double residual = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t c = 0; c < n; ++c)
+        {
+            double s = -eig.values[c] * eig.vectors(i, c);
+            for (std::size_t k = 0; k < n; ++k)
+                s += (k <= i ? A(i, k) : A(k, i)) * eig.vectors(k, c);
+            residual = std::max(residual, std::fabs(s));
+        };
+
+    double agree = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+        agree = std::max(agree, std::fabs(eig.values[i] - vals.values[i]));
+
+    SEONCORE_CHECK(residual <= tol * scale);
+    SEONCORE_CHECK(orthogonality(eig.vectors, n) <= tol);
+    SEONCORE_CHECK(agree <= tol * scale);
+};
+
+// Random symmetric matrices at sizes around the tridiagonalization block,
+// the QL rotation batch and the row bands the rotations are applied in,
+// plus known spectra with repeated and zero eigenvalues.
+void eigh_residuals()
+{
+    std::mt19937 rng(5);
+
+    for (std::size_t n : { 1, 2, 3, 31, 32, 33, 65, 100, 130 })
+        check_eigh(random_matrix(n, n, rng), 1e-12);
+
+    for (std::size_t n : { 4, 40, 97 })
+    {
+        std::vector<double> lambda(n);
+        for (std::size_t i = 0; i < n; ++i)
+            lambda[i] = static_cast<double>(i % 5) - 2.0;
+
+        const DenseMatrix<double> A = with_spectrum(lambda, rng);
+        check_eigh(A, 1e-12);
+
+        std::sort(lambda.begin(), lambda.end());
+        const auto vals = seoncore::linalg::eigh(A, false);
+        double err = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+            err = std::max(err, std::fabs(vals.values[i] - lambda[i]));
+        SEONCORE_CHECK(err <= 1e-12);
+    };
+
+    DenseMatrix<double> D(6, 6);
+    const double diag[] = { 3.0, -1.0, 3.0, 0.0, -1.0, 7.0 };
+    for (std::size_t i = 0; i < 6; ++i) D(i, i) = diag[i];
+    const auto eig = seoncore::linalg::eigh(D);
+    const std::vector<double> sorted = { -1.0, -1.0, 0.0, 3.0, 3.0, 7.0 };
+    SEONCORE_CHECK(eig.values == sorted);
+    SEONCORE_CHECK(orthogonality(eig.vectors, 6) <= 1e-15);
+};
+
+// max |A - U diag(S) V^T|.
+double reconstruction_error(const DenseMatrix<double>& A, const seoncore::linalg::SVD<double>& f)
+{
+    double m = 0.0;
+    for (std::size_t i = 0; i < A.rows(); ++i)
+        for (std::size_t j = 0; j < A.cols(); ++j)
+        {
+            double s = A(i, j);
+            for (std::size_t k = 0; k < f.S.size(); ++k) s -= f.U(i, k) * f.S[k] * f.V(j, k);
+            m = std::max(m, std::fabs(s));
+        };
+    return m;
+};
+
+// A = U S V^T with orthonormal U and V and nonnegative descending S, for
+// tall, wide and square shapes and a rank-deficient matrix (whose
+// singular vectors are only checked over its rank). truncated_svd and
+// randomized_svd return the leading triplets of the same factorization.
+void svd_residuals()
+{
+    std::mt19937 rng(9);
+
+    const std::pair<std::size_t, std::size_t> shapes[] = { { 1, 1 }, { 1, 6 }, { 6, 1 }, { 5, 3 }, { 3, 5 }, { 40, 17 }, { 17, 40 }, { 64, 64 } };
+    for (const auto& [m, n] : shapes)
+    {
+        const DenseMatrix<double> A = random_matrix(m, n, rng);
+        const auto f = seoncore::linalg::svd(A);
+        const std::size_t r = std::min(m, n);
+
+        SEONCORE_CHECK(f.S.size() == r && f.U.rows() == m && f.U.cols() == r && f.V.rows() == n && f.V.cols() == r);
+        SEONCORE_CHECK(std::is_sorted(f.S.rbegin(), f.S.rend()) && f.S.back() >= 0.0);
+        SEONCORE_CHECK(reconstruction_error(A, f) <= 1e-12 * max_abs(A));
+        SEONCORE_CHECK(orthogonality(f.U, r) <= 1e-12);
+        SEONCORE_CHECK(orthogonality(f.V, r) <= 1e-12);
+    };
+
+    // Rank 4, 30 x 24, with singular values spread over two decades.
+    const std::size_t m = 30;
+    const std::size_t n = 24;
+    const std::size_t rank = 4;
+    const DenseMatrix<double> X = random_matrix(m, rank, rng);
+    const DenseMatrix<double> Y = random_matrix(n, rank, rng);
+    DenseMatrix<double> A(m, n);
+    for (std::size_t i = 0; i < m; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+            for (std::size_t k = 0; k < rank; ++k)
+                A(i, j) += X(i, k) * Y(j, k) * std::pow(10.0, -0.5 * static_cast<double>(k));
+
+    const auto f = seoncore::linalg::svd(A);
+    const double scale = max_abs(A);
+    SEONCORE_CHECK(reconstruction_error(A, f) <= 1e-12 * scale);
+    SEONCORE_CHECK(orthogonality(f.U, rank) <= 1e-12);
+    SEONCORE_CHECK(orthogonality(f.V, rank) <= 1e-12);
+    SEONCORE_CHECK(f.S[rank] <= 1e-12 * f.S[0]);
+
+    const auto t = seoncore::linalg::truncated_svd(A, rank);
+    SEONCORE_CHECK(t.S.size() == rank && t.U.cols() == rank && t.V.cols() == rank);
+    SEONCORE_CHECK(reconstruction_error(A, t) <= 1e-11 * scale);
+
+    const auto z = seoncore::linalg::randomized_svd(A, rank);
+    SEONCORE_CHECK(z.S.size() == rank && z.U.cols() == rank && z.V.cols() == rank);
+    SEONCORE_CHECK(reconstruction_error(A, z) <= 1e-10 * scale);
+    for (std::size_t k = 0; k < rank; ++k)
+        SEONCORE_CHECK(std::fabs(z.S[k] - f.S[k]) <= 1e-10 * f.S[0]);
+};
+
+}; // namespace
+
+void eigen_tests()
+{
+    eigh_residuals();
+    svd_residuals();
+};
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <vector>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/epilogue.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Major;
+using seoncore::matrix::DenseMatrix;
+using seoncore::ops::GemmEpilogue;
+using seoncore::views::VectorView;
+
+namespace
+{
+
+DenseMatrix<double> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng, Major major = Major::Row)
+{
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+    DenseMatrix<double> A(m, n, major);
+    for (double& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+DenseMatrix<double> transposed_copy(const DenseMatrix<double>& A)
+{
+    DenseMatrix<double> T(A.cols(), A.rows());
+    for (std::size_t i = 0; i < A.rows(); ++i)
+        for (std::size_t j = 0; j < A.cols(); ++j)
+            T(j, i) = A(i, j);
+    return T;
+};
+
+double max_rel_diff(const DenseMatrix<double>& a, const DenseMatrix<double>& b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols()) return INFINITY;
+
+    double m = 0.0;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            m = std::max(m, std::fabs(a(i, j) - b(i, j)) / (1.0 + std::fabs(b(i, j))));
+    return m;
+};
+
+// Scalar forms of the functors, written out independently of epilogue.hpp.
+struct Relu { double operator()(double v) const { return std::max(v, 0.0); }; };
+struct Abs  { double operator()(double v) const { return std::fabs(v); }; };
+struct Gelu
+{
+    double operator()(double v) const
+    {
+        return 0.5 * v * (1.0 + std::tanh(std::sqrt(2.0 / std::numbers::pi) * (v + 0.044715 * v * v * v)));
+    };
+};
+
+// The unfused route: a plain product, then one elementwise pass per step.
+template <class F>
+DenseMatrix<double> unfused(
+    const DenseMatrix<double>& A, const DenseMatrix<double>& B, const DenseMatrix<double>* C0,
+    double alpha, double beta, const std::vector<double>& rb, const std::vector<double>& cb, F fn)
+{
+    DenseMatrix<double> R = seoncore::ops::matmul(A, B);
+    for (std::size_t i = 0; i < R.rows(); ++i)
+        for (std::size_t j = 0; j < R.cols(); ++j) R(i, j) *= alpha;
+    if (C0)
+        for (std::size_t i = 0; i < R.rows(); ++i)
+            for (std::size_t j = 0; j < R.cols(); ++j) R(i, j) += beta * (*C0)(i, j);
+    if (!rb.empty())
+        for (std::size_t i = 0; i < R.rows(); ++i)
+            for (std::size_t j = 0; j < R.cols(); ++j) R(i, j) += rb[j];
+    if (!cb.empty())
+        for (std::size_t i = 0; i < R.rows(); ++i)
+            for (std::size_t j = 0; j < R.cols(); ++j) R(i, j) += cb[i];
+    for (std::size_t i = 0; i < R.rows(); ++i)
+        for (std::size_t j = 0; j < R.cols(); ++j) R(i, j) = fn(R(i, j));
+    return R;
+};
+
+template <class E>
+E with_biases(E epi, const std::vector<double>& rb, const std::vector<double>& cb)
+{
+    epi.row_bias = VectorView<double>(rb.empty() ? nullptr : rb.data(), rb.size(), 1);
+    epi.col_bias = VectorView<double>(cb.empty() ? nullptr : cb.data(), cb.size(), 1);
+    return epi;
+};
+
+// One epilogue against the unfused route, through matmul and matmul_into,
+// with A and B given plainly and as transposed views of their transposes.
+template <class E, class F>
+void check_epilogue(
+    const DenseMatrix<double>& A, const DenseMatrix<double>& B, E epi, F fn,
+    const std::vector<double>& rb, const std::vector<double>& cb, std::mt19937& rng)
+{
+    epi = with_biases(epi, rb, cb);
+    const DenseMatrix<double> At = transposed_copy(A);
+    const DenseMatrix<double> Bt = transposed_copy(B);
+
+    const DenseMatrix<double> want = unfused(A, B, nullptr, epi.alpha, 0.0, rb, cb, fn);
+    SEONCORE_CHECK(max_rel_diff(seoncore::ops::matmul(A, B, epi), want) <= 1e-13);
+    SEONCORE_CHECK(max_rel_diff(seoncore::ops::matmul(At.transposed(), B, epi), want) <= 1e-13);
+    SEONCORE_CHECK(max_rel_diff(seoncore::ops::matmul(A, Bt.transposed(), epi), want) <= 1e-13);
+    SEONCORE_CHECK(max_rel_diff(seoncore::ops::matmul(At.transposed(), Bt.transposed(), epi), want) <= 1e-13);
+
+    // matmul ignores beta; matmul_into reads it against C's prior values,
+    // in either storage order of C.
+    E scaled = epi;
+    scaled.beta = 1.0;
+    SEONCORE_CHECK(max_rel_diff(seoncore::ops::matmul(A, B, scaled), want) <= 1e-13);
+
+    scaled.beta = -0.75;
+    for (const Major major : { Major::Row, Major::Column })
+    {
+        const DenseMatrix<double> C0 = random_matrix(A.rows(), B.cols(), rng, major);
+        const DenseMatrix<double> want_into = unfused(A, B, &C0, scaled.alpha, scaled.beta, rb, cb, fn);
+
+        DenseMatrix<double> C = C0;
+        seoncore::ops::matmul_into(A, B, C, scaled);
+        SEONCORE_CHECK(max_rel_diff(C, want_into) <= 1e-13);
+
+        C = C0;
+        seoncore::ops::matmul_into(At.transposed(), Bt.transposed(), C, scaled);
+        SEONCORE_CHECK(max_rel_diff(C, want_into) <= 1e-13);
+    };
+};
+
+// Shapes off every register tile, and one deeper than a k block, so the
+// epilogue must run only once per element, after the last block.
+void fused_matches_unfused()
+{
+    const std::size_t shapes[][3] = { { 1, 1, 1 }, { 3, 5, 2 }, { 37, 29, 300 }, { 64, 48, 513 } };
+
+    std::mt19937 rng(107);
+    for (const auto& shape : shapes)
+    {
+        const std::size_t m = shape[0], n = shape[1], k = shape[2];
+        const DenseMatrix<double> A = random_matrix(m, k, rng);
+        const DenseMatrix<double> B = random_matrix(k, n, rng, Major::Column);
+
+        std::uniform_real_distribution<double> ud(-2.0, 2.0);
+        std::vector<double> rb(n), cb(m);
+        for (double& v : rb) v = ud(rng);
+        for (double& v : cb) v = ud(rng);
+        const std::vector<double> none;
+
+        check_epilogue(A, B, GemmEpilogue<double>{}, [](double v) { return v; }, none, none, rng);
+        check_epilogue(A, B, seoncore::ops::make_epilogue(seoncore::ops::epilogue::relu, 0.5), Relu{}, rb, none, rng);
+        check_epilogue(A, B, seoncore::ops::make_epilogue(seoncore::ops::epilogue::gelu, -1.5), Gelu{}, none, cb, rng);
+        check_epilogue(A, B, seoncore::ops::make_epilogue(seoncore::tags::abs, 3.0), Abs{}, rb, cb, rng);
+
+        auto square = [](double v) { return v * v; };
+        check_epilogue(A, B, seoncore::ops::make_epilogue(square, 0.25), square, rb, cb, rng);
+    };
+};
+
+}; // namespace
+
+void epilogue_tests()
+{
+    fused_matches_unfused();
+};
@@ -0,0 +1,319 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <seoncore/ops/gemm.hpp>
+#include <seoncore/ops/gemm_profile.hpp>
+#include <seoncore/ops/gemm_tune.hpp>
+#include "check.hpp"
+
+using seoncore::ops::GemmConfig;
+using seoncore::ops::GemmKernel;
+using seoncore::ops::GemmProfile;
+using seoncore::ops::GemmSplit;
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+// A scratch directory, removed again on scope exit.
+struct ScratchDir
+{
+    fs::path path;
+
+    ScratchDir()
+    {
+        std::random_device rd;
+        path = fs::temp_directory_path() / ("seoncore_gemm_test_" + std::to_string(rd()));
+        fs::create_directories(path);
+    };
+
+    ~ScratchDir()
+    {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    };
+};
+
+void write_file(const fs::path& p, const std::string& text)
+{
+    fs::create_directories(p.parent_path());
+    std::ofstream(p) << text;
+};
+
+bool same_entries(const GemmProfile& a, const GemmProfile& b)
+{
+    if (a.entries().size() != b.entries().size()) return false;
+    for (const auto& e : a.entries())
+    {
+        const auto it = std::find_if(b.entries().begin(), b.entries().end(), [&e](const GemmProfile::Entry& f)
+        {
+            return f.type == e.type && f.bm == e.bm && f.bn == e.bn && f.bk == e.bk;
+        });
+        if (it == b.entries().end() || !(it->config == e.config)) return false;
+    };
+    return true;
+};
+
+// Comments, blank lines, short lines, unknown kernel or split names and
+// zero block sizes are skipped; the remaining lines are kept, the last of
+// two for the same bucket winning.
+void profile_skips_malformed_lines()
+{
+    std::istringstream in(
+        "# seoncore gemm profile v1\n"
+        "\n"
+        "f64 6 6 6 8x8 64 128 1024 2 m\n"
+        "f64 7 7 7 8x8 64 128\n"
+        "f64 7 7 7 9x9 64 128 1024 0 auto\n"
+        "f64 7 7 7 4x4 64 128 1024 0 sideways\n"
+        "f64 7 7 7 4x4 0 128 1024 0 auto\n"
+        "f64 7 7 7 4x4 64 0 1024 0 auto\n"
+        "f64 x 7 7 4x4 64 128 1024 0 auto\n"
+        "garbage\n"
+        "f32 3 3 3 6x16 32 64 256 1 n\n"
+        "f64 6 6 6 4x4 96 384 4096 0 auto\n");
+
+    const GemmProfile p = GemmProfile::read(in);
+    SEONCORE_CHECK(p.entries().size() == 2);
+
+    const GemmConfig f64 = p.lookup("f64", 64, 64, 64);
+    SEONCORE_CHECK(f64 == (GemmConfig{ GemmKernel::Tile4x4, 96, 384, 4096, 0, GemmSplit::Auto }));
+    const GemmConfig f32 = p.lookup("f32", 8, 8, 8);
+    SEONCORE_CHECK(f32 == (GemmConfig{ GemmKernel::Tile6x16, 32, 64, 256, 1, GemmSplit::N }));
+
+    // Nearest bucket for other shapes; the fallback for untracked types.
+    SEONCORE_CHECK(p.lookup("f64", 4096, 4096, 4096) == f64);
+    SEONCORE_CHECK(p.lookup("c64", 64, 64, 64) == GemmConfig{});
+    const GemmConfig fallback{ GemmKernel::Tile8x4, 1, 2, 3, 4, GemmSplit::M };
+    SEONCORE_CHECK(p.lookup("c64", 64, 64, 64, fallback) == fallback);
+
+    // Nothing usable, or no file at all: an empty profile and the defaults.
+    std::istringstream junk("f64 1 2\n\x01\x02\n# only a comment\n");
+    SEONCORE_CHECK(GemmProfile::read(junk).empty());
+
+    const ScratchDir dir;
+    SEONCORE_CHECK(GemmProfile::load((dir.path / "missing.profile").string()).empty());
+    SEONCORE_CHECK(GemmProfile::load((dir.path / "missing.profile").string()).lookup("f64", 8, 8, 8) == GemmConfig{});
+};
+
+// write() then read() gives the same entries, including every kernel and
+// split name.
+void profile_write_read_round_trip()
+{
+    GemmProfile p;
+    const GemmKernel kernels[] = { GemmKernel::Tile4x4, GemmKernel::Tile4x8, GemmKernel::Tile8x4,
+                                   GemmKernel::Tile8x8, GemmKernel::Tile6x16 };
+    const GemmSplit splits[] = { GemmSplit::Auto, GemmSplit::M, GemmSplit::N };
+    for (std::size_t i = 0; i < 5; ++i)
+        p.set_bucket(i % 2 ? "f32" : "f64", i, i + 1, i + 2,
+                     { kernels[i], 32 * (i + 1), 64 * (i + 1), 256 * (i + 1), i, splits[i % 3] });
+
+    std::stringstream s;
+    p.write(s);
+    SEONCORE_CHECK(same_entries(GemmProfile::read(s), p));
+};
+
+// A tuned profile installs itself, is written where asked, and reads back
+// to the same entries.
+void tuned_profile_round_trip()
+{
+    const auto previous = seoncore::ops::gemm_profile();
+    const ScratchDir dir;
+    const std::string path = (dir.path / "nested" / "gemm.profile").string();
+
+    seoncore::ops::GemmTuneOptions opts;
+    opts.shapes = { { 16, 16, 16 }, { 40, 24, 70 } };
+    opts.repeats = 1;
+    opts.min_seconds = 0.0;
+
+    SEONCORE_CHECK(seoncore::ops::tune_gemm_profile(path, opts));
+
+    const GemmProfile loaded = GemmProfile::load(path);
+    SEONCORE_CHECK(loaded.entries().size() == 4);
+    SEONCORE_CHECK(same_entries(loaded, *seoncore::ops::gemm_profile()));
+    SEONCORE_CHECK(loaded.lookup("f32", 40, 24, 70) == seoncore::ops::gemm_config<float>(40, 24, 70));
+    SEONCORE_CHECK(loaded.lookup("f64", 16, 16, 16) == seoncore::ops::gemm_config<double>(16, 16, 16));
+
+    // An unwritable path still installs the profile.
+    write_file(dir.path / "file", "");
+    SEONCORE_CHECK(!seoncore::ops::tune_gemm_profile((dir.path / "file" / "gemm.profile").string(), opts));
+    SEONCORE_CHECK(seoncore::ops::gemm_profile()->entries().size() == 4);
+
+    seoncore::ops::set_gemm_profile(*previous);
+};
+
+#if defined(__unix__)
+
+// Sets (or, with nullopt, unsets) an environment variable and puts the old
+// value back on scope exit.
+struct EnvVar
+{
+    std::string                 name;
+    std::optional<std::string>  saved;
+
+    EnvVar(std::string n, std::optional<std::string> value)
+        : name(std::move(n))
+    {
+        if (const char* v = std::getenv(name.c_str())) saved = v;
+        set(value);
+    };
+
+    ~EnvVar() { set(saved); };
+
+    void set(const std::optional<std::string>& value) const
+    {
+        if (value)
+            ::setenv(name.c_str(), value->c_str(), 1);
+        else
+            ::unsetenv(name.c_str());
+    };
+};
+
+// The path follows $SEONCORE_GEMM_PROFILE, then $XDG_CACHE_HOME, then
+// $HOME, and the startup profile is read from it. A malformed file there
+// loads what it can, and a missing one leaves the defaults.
+void profile_from_environment()
+{
+    const ScratchDir dir;
+    const std::string explicit_path = (dir.path / "explicit.profile").string();
+    const std::string xdg = (dir.path / "xdg").string();
+    const std::string home = (dir.path / "home").string();
+
+    EnvVar tune("SEONCORE_GEMM_TUNE", std::nullopt);
+    EnvVar env_profile("SEONCORE_GEMM_PROFILE", explicit_path);
+    EnvVar env_xdg("XDG_CACHE_HOME", xdg);
+    EnvVar env_home("HOME", home);
+
+    SEONCORE_CHECK(seoncore::ops::gemm_profile_path() == explicit_path);
+    env_profile.set(std::nullopt);
+    SEONCORE_CHECK(seoncore::ops::gemm_profile_path() == xdg + "/seoncore/gemm.profile");
+    env_xdg.set("");
+    SEONCORE_CHECK(seoncore::ops::gemm_profile_path() == home + "/.cache/seoncore/gemm.profile");
+    env_home.set(std::nullopt);
+    SEONCORE_CHECK(seoncore::ops::gemm_profile_path().empty());
+    SEONCORE_CHECK(seoncore::ops::detail::_startup_gemm_profile().empty());
+
+    const GemmConfig tuned{ GemmKernel::Tile8x8, 64, 128, 1024, 0, GemmSplit::N };
+    write_file(xdg + "/seoncore/gemm.profile", "f64 6 6 6 8x8 64 128 1024 0 n\n");
+    env_xdg.set(xdg);
+    GemmProfile p = seoncore::ops::detail::_startup_gemm_profile();
+    SEONCORE_CHECK(p.entries().size() == 1 && p.lookup("f64", 64, 64, 64) == tuned);
+
+    write_file(explicit_path, "f64 6 6 6 8x8 64 128\nf64 6 6 6 8x8 64 128 1024 0 n\nf32 1 1 1 7x7 1 1 1 0 m\n");
+    env_profile.set(explicit_path);
+    p = seoncore::ops::detail::_startup_gemm_profile();
+    SEONCORE_CHECK(p.entries().size() == 1 && p.lookup("f64", 64, 64, 64) == tuned);
+    SEONCORE_CHECK(p.lookup("f32", 64, 64, 64) == GemmConfig{});
+
+    env_profile.set((dir.path / "absent.profile").string());
+    SEONCORE_CHECK(seoncore::ops::detail::_startup_gemm_profile().empty());
+};
+
+#endif
+
+double naive(const std::vector<double>& a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+             const std::vector<double>& b, std::ptrdiff_t rsb, std::ptrdiff_t csb,
+             std::size_t i, std::size_t j, std::size_t k)
+{
+    double s = 0.0;
+    for (std::size_t p = 0; p < k; ++p)
+        s += a[i * rsa + p * csa] * b[p * rsb + j * csb];
+    return s;
+};
+
+// Every kernel, with blocks far smaller than the defaults and shapes that
+// are multiples of none of MR, NR, mc, kc or nc, so every loop has a
+// partial last step. Operands are read row- and column-major and C is
+// written both ways, with alpha and beta in play.
+void edge_tiles_match_naive()
+{
+    const GemmKernel kernels[] = { GemmKernel::Tile4x4, GemmKernel::Tile4x8, GemmKernel::Tile8x4,
+                                   GemmKernel::Tile8x8, GemmKernel::Tile6x16 };
+    const std::size_t shapes[][3] = { { 1, 1, 1 }, { 1, 17, 5 }, { 13, 1, 9 }, { 13, 19, 23 }, { 43, 37, 31 }, { 7, 50, 3 } };
+    const GemmConfig blockings[] = {
+        { GemmKernel::Tile4x4, 10, 7, 20, 0, GemmSplit::M },
+        { GemmKernel::Tile4x4, 5, 1, 3, 0, GemmSplit::N },
+        { GemmKernel::Tile4x4, 128, 256, 4096, 0, GemmSplit::Auto },
+    };
+
+    std::mt19937 rng(109);
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+
+    std::size_t wrong = 0;
+    for (const GemmKernel kernel : kernels)
+        for (GemmConfig cfg : blockings)
+        {
+            cfg.kernel = kernel;
+            for (const auto& shape : shapes)
+            {
+                const std::size_t m = shape[0], n = shape[1], k = shape[2];
+                std::vector<double> a(m * k), b(k * n), c0(m * n);
+                for (double& v : a) v = ud(rng);
+                for (double& v : b) v = ud(rng);
+                for (double& v : c0) v = ud(rng);
+
+                for (int layout = 0; layout < 4; ++layout)
+                {
+                    // bit 0: A column-major, bit 1: B column-major; C follows A.
+                    const std::ptrdiff_t rsa = (layout & 1) ? 1 : std::ptrdiff_t(k);
+                    const std::ptrdiff_t csa = (layout & 1) ? std::ptrdiff_t(m) : 1;
+                    const std::ptrdiff_t rsb = (layout & 2) ? 1 : std::ptrdiff_t(n);
+                    const std::ptrdiff_t csb = (layout & 2) ? std::ptrdiff_t(k) : 1;
+                    const std::ptrdiff_t rsc = (layout & 1) ? 1 : std::ptrdiff_t(n);
+                    const std::ptrdiff_t csc = (layout & 1) ? std::ptrdiff_t(m) : 1;
+
+                    std::vector<double> c = c0;
+                    seoncore::ops::gemm_with<double>(cfg, m, n, k, 1.5, a.data(), rsa, csa, b.data(), rsb, csb,
+                                                     -0.5, c.data(), rsc, csc);
+
+                    for (std::size_t i = 0; i < m; ++i)
+                        for (std::size_t j = 0; j < n; ++j)
+                        {
+                            const double want = 1.5 * naive(a, rsa, csa, b, rsb, csb, i, j, k) - 0.5 * c0[i * rsc + j * csc];
+                            wrong += std::fabs(c[i * rsc + j * csc] - want) > 1e-13 * (1.0 + std::fabs(want));
+                        };
+                };
+            };
+        };
+    SEONCORE_CHECK(wrong == 0);
+
+    // The same through gemm() and the active profile, in float, past one
+    // default k block.
+    const std::size_t m = 67, n = 45, k = 301;
+    std::vector<float> af(m * k), bf(k * n), cf(m * n);
+    for (float& v : af) v = static_cast<float>(ud(rng));
+    for (float& v : bf) v = static_cast<float>(ud(rng));
+    seoncore::ops::gemm<float>(m, n, k, 1.0f, af.data(), k, 1, bf.data(), n, 1, 0.0f, cf.data(), n, 1);
+
+    double err = 0.0;
+    for (std::size_t i = 0; i < m; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            double s = 0.0;
+            for (std::size_t p = 0; p < k; ++p) s += double(af[i * k + p]) * double(bf[p * n + j]);
+            err = std::max(err, std::fabs(double(cf[i * n + j]) - s));
+        };
+    SEONCORE_CHECK(err <= 1e-4);
+};
+
+}; // namespace
+
+void gemm_tests()
+{
+    profile_skips_malformed_lines();
+    profile_write_read_round_trip();
+    tuned_profile_round_trip();
+#if defined(__unix__)
+    profile_from_environment();
+#endif
+    edge_tiles_match_naive();
+};
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <seoncore/async/graph.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include "check.hpp"
+
+using seoncore::async::TaskGraph;
+using seoncore::matrix::DenseMatrix;
+
+namespace
+{
+
+using Graph = TaskGraph<double>;
+
+DenseMatrix<double> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng)
+{
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+    DenseMatrix<double> A(m, n);
+    for (double& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+enum class Mode { Sync, Async };
+
+void run(Graph& g, Mode mode)
+{
+    if (mode == Mode::Sync)
+        g.run();
+    else
+        seoncore::async::sync_wait(g.run_async());
+};
+
+// Diamond: p = A * B fans out to abs(p) and transpose(p), which join again
+// in abs(p) * transpose(p). The input matrix is held by the graph and read
+// in place, so every run sees the same buffer.
+void diamond(Mode mode)
+{
+    std::mt19937 rng(101);
+    DenseMatrix<double> A = random_matrix(9, 6, rng);
+    const DenseMatrix<double> B = random_matrix(6, 7, rng);
+
+    // Expected values, one element at a time.
+    DenseMatrix<double> P(9, 7);
+    for (std::size_t i = 0; i < 9; ++i)
+        for (std::size_t j = 0; j < 7; ++j)
+            for (std::size_t k = 0; k < 6; ++k)
+                P(i, j) += A(i, k) * B(k, j);
+
+    double want = 0.0;
+    for (std::size_t i = 0; i < 9; ++i)
+        for (std::size_t j = 0; j < 9; ++j)
+        {
+            double s = 0.0;
+            for (std::size_t k = 0; k < 7; ++k) s += std::fabs(P(i, k)) * P(j, k);
+            want += s;
+        };
+
+    const double* buffer = A.data();
+
+    Graph g;
+    const auto a = g.input(std::move(A));
+    const auto b = g.input(B);
+    const auto p = g.matmul(a, b);
+    const auto l = g.abs(p);
+    const auto r = g.transpose(p);
+    std::atomic<int> joins{ 0 };
+    const auto j = g.apply({ l, r }, [l, r, &joins](const Graph& G)
+    {
+        ++joins;
+        return Graph::value_type(seoncore::ops::matmul(G.matrix(l), G.matrix(r)));
+    });
+    const auto s = g.sum(j);
+    SEONCORE_CHECK(g.size() == 7);
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        run(g, mode);
+
+        SEONCORE_CHECK(g.matrix(a).data() == buffer);
+        SEONCORE_CHECK(g.matrix(j).rows() == 9 && g.matrix(j).cols() == 9);
+        SEONCORE_CHECK(std::fabs(g.scalar(s) - want) <= 1e-12 * (1.0 + std::fabs(want)));
+
+        double err = 0.0;
+        for (std::size_t i = 0; i < 9; ++i)
+            for (std::size_t k = 0; k < 7; ++k)
+                err = std::max(err, std::fabs(g.matrix(p)(i, k) - P(i, k)) + std::fabs(g.matrix(r)(k, i) - P(i, k)));
+        SEONCORE_CHECK(err <= 1e-12);
+    };
+    SEONCORE_CHECK(joins == 2);
+};
+
+// A throwing node on one side of the diamond: the join and everything after
+// it are skipped, the other side still runs, and the exception reaches the
+// caller of either run. A later run behaves the same.
+void diamond_exception(Mode mode)
+{
+    std::mt19937 rng(103);
+
+    Graph g;
+    const auto a = g.input(random_matrix(5, 5, rng));
+    const auto l = g.apply({ a }, [](const Graph&) -> Graph::value_type { throw std::runtime_error("node"); });
+    const auto r = g.abs(a);
+    std::atomic<int> after{ 0 };
+    const auto j = g.apply({ l, r }, [&after](const Graph&) { ++after; return Graph::value_type(0.0); });
+    g.apply({ j }, [&after](const Graph&) { ++after; return Graph::value_type(0.0); });
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        bool caught = false;
+        try
+        {
+            run(g, mode);
+        }
+        catch (const std::runtime_error&)
+        {
+            caught = true;
+        };
+        SEONCORE_CHECK(caught);
+        SEONCORE_CHECK(after == 0);
+        SEONCORE_CHECK(g.matrix(r)(3, 2) == std::fabs(g.matrix(a)(3, 2)));
+    };
+};
+
+}; // namespace
+
+void graph_tests()
+{
+    diamond(Mode::Sync);
+    diamond(Mode::Async);
+    diamond_exception(Mode::Sync);
+    diamond_exception(Mode::Async);
+};
@@ -0,0 +1,16 @@
+#include "check.hpp"
+
+#if !SEONCORE_INSTRUMENT
+#error "built with SEONCORE_INSTRUMENT=1 (see CMakeLists.txt)"
+#endif
+
+void instrument_tests();
+
+// The instrumentation tests in an ON build, for configurations whose main
+// test suite has the hooks compiled out.
+int main()
+{
+    instrument_tests();
+
+    return seoncore::tests::failures() == 0 ? 0 : 1;
+};
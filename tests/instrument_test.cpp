@@ -0,0 +1,263 @@
+#include <cctype>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <seoncore/instrument/instrument.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/matrix.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/ops/reduce.hpp>
+#include "check.hpp"
+
+using seoncore::matrix::DenseMatrix;
+
+namespace
+{
+
+#if SEONCORE_INSTRUMENT
+
+namespace instrument = seoncore::instrument;
+
+// Just enough of a JSON parser to tell whether a document is well formed.
+class JsonChecker
+{
+public:
+    explicit JsonChecker(std::string_view s) : _s(s) {};
+
+    bool valid()
+    {
+        _pos = 0;
+        return _value() && (_ws(), _pos == _s.size());
+    };
+
+private:
+    std::string_view    _s;
+    std::size_t         _pos = 0;
+
+    void _ws()
+    {
+        while (_pos < _s.size() && std::isspace(static_cast<unsigned char>(_s[_pos]))) ++_pos;
+    };
+
+    bool _eat(char c)
+    {
+        _ws();
+        if (_pos < _s.size() && _s[_pos] == c)
+        {
+            ++_pos;
+            return true;
+        };
+        return false;
+    };
+
+    bool _literal(std::string_view word)
+    {
+        if (_s.substr(_pos, word.size()) != word) return false;
+        _pos += word.size();
+        return true;
+    };
+
+    bool _string()
+    {
+        if (!_eat('"')) return false;
+        while (_pos < _s.size())
+        {
+            const char c = _s[_pos++];
+            if (c == '"') return true;
+            if (static_cast<unsigned char>(c) < 0x20) return false;
+            if (c == '\\')
+            {
+                if (_pos == _s.size() || std::string_view("\"\\/bfnrtu").find(_s[_pos]) == std::string_view::npos) return false;
+                ++_pos;
+            };
+        };
+        return false;
+    };
+
+    bool _number()
+    {
+        const std::size_t start = _pos;
+        if (_pos < _s.size() && _s[_pos] == '-') ++_pos;
+
+        const std::size_t int_start = _pos;
+        while (_pos < _s.size() && std::isdigit(static_cast<unsigned char>(_s[_pos]))) ++_pos;
+        if (_pos == int_start) return false;
+        if (_s[int_start] == '0' && _pos - int_start > 1) return false;
+
+        if (_pos < _s.size() && _s[_pos] == '.')
+        {
+            const std::size_t frac = ++_pos;
+            while (_pos < _s.size() && std::isdigit(static_cast<unsigned char>(_s[_pos]))) ++_pos;
+            if (_pos == frac) return false;
+        };
+        if (_pos < _s.size() && (_s[_pos] == 'e' || _s[_pos] == 'E'))
+        {
+            ++_pos;
+            if (_pos < _s.size() && (_s[_pos] == '+' || _s[_pos] == '-')) ++_pos;
+            const std::size_t exp = _pos;
+            while (_pos < _s.size() && std::isdigit(static_cast<unsigned char>(_s[_pos]))) ++_pos;
+            if (_pos == exp) return false;
+        };
+        return _pos > start;
+    };
+
+    bool _value()
+    {
+        _ws();
+        if (_pos == _s.size()) return false;
+
+        switch (_s[_pos])
+        {
+            case '{':
+            {
+                ++_pos;
+                if (_eat('}')) return true;
+                do
+                {
+                    if (!_string() || !_eat(':') || !_value()) return false;
+                }
+                while (_eat(','));
+                return _eat('}');
+            };
+            case '[':
+            {
+                ++_pos;
+                if (_eat(']')) return true;
+                do
+                {
+                    if (!_value()) return false;
+                }
+                while (_eat(','));
+                return _eat(']');
+            };
+            case '"':   return _string();
+            case 't':   return _literal("true");
+            case 'f':   return _literal("false");
+            case 'n':   return _literal("null");
+            default:    return _number();
+        };
+    };
+
+}; // class JsonChecker
+
+std::string trace()
+{
+    std::ostringstream os;
+    instrument::write_chrome_trace(os);
+    return os.str();
+};
+
+std::size_t count(const std::string& s, std::string_view needle)
+{
+    std::size_t n = 0;
+    for (std::size_t p = s.find(needle); p != std::string::npos; p = s.find(needle, p + 1)) ++n;
+    return n;
+};
+
+// Scopes at the ops:: dispatch points record one call each, with the shape,
+// FLOPs, dispatch path and the allocations made inside the call.
+void records_op_scopes()
+{
+    const DenseMatrix<double> A(8, 6);
+    const DenseMatrix<double> B(6, 5);
+
+    instrument::reset();
+    const DenseMatrix<double> C = seoncore::ops::matmul(A, B);
+    const double s = seoncore::ops::sum(C);
+    SEONCORE_CHECK(s == 0.0);
+
+    const auto stats = instrument::stats();
+    SEONCORE_CHECK(stats.size() == 2 && stats.count("matmul") && stats.count("sum"));
+
+    const instrument::OpStats& mm = stats.at("matmul");
+    SEONCORE_CHECK(mm.calls == 1 && mm.tagged == 1 && mm.fallback == 0);
+    SEONCORE_CHECK(mm.flops == 2.0 * 8 * 5 * 6);
+    SEONCORE_CHECK(mm.bytes == (8.0 * 6 + 6 * 5 + 8 * 5) * sizeof(double));
+    SEONCORE_CHECK(mm.allocs == 1);
+    SEONCORE_CHECK(stats.at("sum").calls == 1 && stats.at("sum").direct == 1 && stats.at("sum").allocs == 0);
+
+    const auto events = instrument::events();
+    SEONCORE_CHECK(events.size() == 2);
+    SEONCORE_CHECK(std::string_view(events[0].op) == "matmul" && events[0].rows == 8 && events[0].cols == 5 && events[0].inner == 6);
+    SEONCORE_CHECK(std::string_view(events[1].op) == "sum" && events[1].start_ns >= events[0].start_ns + events[0].dur_ns);
+    SEONCORE_CHECK(events[0].tid == events[1].tid);
+};
+
+// Allocations are counted per materialized buffer; a deep copy counts as a
+// "copy" op with an allocation, a copy-on-write copy as one with neither
+// bytes nor allocation.
+void counts_allocs_and_copies()
+{
+    const auto before = instrument::thread_allocs().count;
+    const auto total_before = instrument::total_allocs().load();
+    DenseMatrix<double> A(4, 7);
+    const DenseMatrix<double> empty(0, 3);
+    SEONCORE_CHECK(instrument::thread_allocs().count == before + 1);
+    SEONCORE_CHECK(instrument::total_allocs().load() >= total_before + 1);
+
+    instrument::reset();
+    DenseMatrix<double> B = A;
+    B = A;
+    const auto stats = instrument::stats();
+    SEONCORE_CHECK(stats.count("copy") && stats.at("copy").calls == 2);
+    SEONCORE_CHECK(stats.at("copy").allocs == 2);
+    SEONCORE_CHECK(stats.at("copy").bytes == 2 * 2.0 * 4 * 7 * sizeof(double));
+
+    const seoncore::matrix::SharedDenseMatrix<double> S(4, 7);
+    instrument::reset();
+    const auto shared_before = instrument::thread_allocs().count;
+    const seoncore::matrix::SharedDenseMatrix<double> T = S;
+    SEONCORE_CHECK(instrument::stats().at("copy").calls == 1);
+    SEONCORE_CHECK(instrument::stats().at("copy").bytes == 0.0 && instrument::stats().at("copy").allocs == 0);
+    SEONCORE_CHECK(instrument::thread_allocs().count == shared_before);
+};
+
+// The Chrome trace is valid JSON with one complete event per recorded call,
+// empty or not. Past the event capacity, calls are aggregated but dropped
+// from the trace.
+void chrome_trace_is_json()
+{
+    instrument::reset();
+    SEONCORE_CHECK(JsonChecker(trace()).valid());
+    SEONCORE_CHECK(count(trace(), "\"ph\":\"X\"") == 0);
+
+    const DenseMatrix<double> A(40, 30);
+    const DenseMatrix<double> B(30, 20);
+    for (int i = 0; i < 3; ++i) (void)seoncore::ops::max(seoncore::ops::matmul(A, B));
+
+    const std::string t = trace();
+    SEONCORE_CHECK(JsonChecker(t).valid());
+    SEONCORE_CHECK(count(t, "\"ph\":\"X\"") == instrument::events().size() && instrument::events().size() == 6);
+    SEONCORE_CHECK(count(t, "\"name\":\"matmul\"") == 3 && count(t, "\"cat\":\"tagged\"") == 3);
+
+    SEONCORE_CHECK(!JsonChecker(t.substr(0, t.size() - 1)).valid());
+    SEONCORE_CHECK(!JsonChecker("{\"a\":[1,2,]}").valid());
+
+    instrument::reset();
+    instrument::Registry::instance().set_event_capacity(2);
+    for (int i = 0; i < 3; ++i) (void)seoncore::ops::sum(A);
+    SEONCORE_CHECK(instrument::events().size() == 2 && instrument::Registry::instance().dropped() == 1);
+    SEONCORE_CHECK(instrument::stats().at("sum").calls == 3);
+    SEONCORE_CHECK(JsonChecker(trace()).valid());
+    instrument::Registry::instance().set_event_capacity(std::size_t{1} << 20);
+    instrument::reset();
+};
+
+#endif
+
+}; // namespace
+
+void instrument_tests()
+{
+#if SEONCORE_INSTRUMENT
+    records_op_scopes();
+    counts_allocs_and_copies();
+    chrome_trace_is_json();
+#else
+    // Compiled out: the hooks record nothing.
+    const DenseMatrix<double> A(3, 3);
+    (void)seoncore::ops::matmul(A, A);
+    SEONCORE_CHECK(!seoncore::instrument::enabled && seoncore::instrument::stats().empty());
+#endif
+};
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/linalg/linalg.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/blas.hpp>
+#include <seoncore/views/vec.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Major;
+using seoncore::matrix::DenseMatrix;
+using seoncore::views::VectorView;
+
+namespace
+{
+
+double max_diff(const DenseMatrix<double>& a, const DenseMatrix<double>& b)
+{
+    double m = 0.0;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            m = std::max(m, std::fabs(a(i, j) - b(i, j)));
+    return m;
+};
+
+// X^T X + n I for a random X, symmetric positive definite and well
+// conditioned.
+DenseMatrix<double> spd(std::size_t n, std::mt19937& rng)
+{
+    std::normal_distribution<double> nd;
+    DenseMatrix<double> X(n + 8, n);
+    for (double& v : X.flatten()) v = nd(rng);
+
+    DenseMatrix<double> A(n, n);
+    seoncore::ops::syrk(1.0, X.transposed(), 0.0, A);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A(i, i) += static_cast<double>(n);
+        for (std::size_t j = i + 1; j < n; ++j) A(i, j) = A(j, i);
+    };
+    return A;
+};
+
+// L L^T reproduces A, and an update followed by a downdate by the same
+// vector gives back L, with L stored in either order. Sizes straddle the
+// factorization block.
+void cholesky_round_trip()
+{
+    std::mt19937 rng(3);
+    std::normal_distribution<double> nd;
+
+    for (std::size_t n : { 1, 7, 64, 65, 150 })
+    {
+        DenseMatrix<double> A = spd(n, rng);
+        const auto c = seoncore::linalg::cholesky(A);
+        SEONCORE_CHECK(c.ok);
+
+        DenseMatrix<double> LLt(n, n);
+        seoncore::ops::syrk(1.0, c.L, 0.0, LLt);
+        double err = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j <= i; ++j)
+                err = std::max(err, std::fabs(LLt(i, j) - A(i, j)));
+        SEONCORE_CHECK(err <= 1e-12 * static_cast<double>(n * n));
+
+        std::vector<double> x(n);
+        for (double& v : x) v = nd(rng);
+        const VectorView<double> xv(x.data(), n, 1);
+
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                A(i, j) += x[i] * x[j];
+        const auto updated = seoncore::linalg::cholesky(A);
+
+        for (Major major : { Major::Row, Major::Column })
+        {
+            DenseMatrix<double> L(n, n, major);
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                    L(i, j) = c.L(i, j);
+
+            seoncore::linalg::cholesky_update(L, xv);
+            SEONCORE_CHECK(max_diff(L, updated.L) <= 1e-10);
+
+            SEONCORE_CHECK(seoncore::linalg::cholesky_downdate(L, xv));
+            SEONCORE_CHECK(max_diff(L, c.L) <= 1e-10);
+        };
+    };
+};
+
+// A downdate that would leave an indefinite matrix is refused before L is
+// touched.
+void cholesky_downdate_rejects()
+{
+    std::mt19937 rng(4);
+    for (std::size_t n : { 1, 10, 100 })
+    {
+        const auto c = seoncore::linalg::cholesky(spd(n, rng));
+        DenseMatrix<double> L = c.L;
+
+        std::vector<double> big(n, 1e3);
+        SEONCORE_CHECK(!seoncore::linalg::cholesky_downdate(L, VectorView<double>(big.data(), n, 1)));
+        SEONCORE_CHECK(max_diff(L, c.L) == 0.0);
+    };
+
+    const DenseMatrix<double> indefinite{ { 1.0, 2.0 }, { 2.0, 1.0 } };
+    SEONCORE_CHECK(!seoncore::linalg::cholesky(indefinite).ok);
+};
+
+// Per-sample pushes, one batch push (several parallel chunks) and a merge
+// of two halves all agree with the two-pass textbook covariance.
+void covariance_agrees()
+{
+    std::mt19937 rng(5);
+    std::normal_distribution<double> nd;
+
+    const std::size_t dim = 12;
+    const std::size_t samples = 1500;
+    DenseMatrix<double> X(samples, dim);
+    for (std::size_t i = 0; i < samples; ++i)
+        for (std::size_t j = 0; j < dim; ++j)
+            X(i, j) = 100.0 + nd(rng) * static_cast<double>(1 + j % 3) + (j ? 0.5 * X(i, j - 1) : 0.0);
+
+    std::vector<double> mean(dim, 0.0);
+    for (std::size_t i = 0; i < samples; ++i)
+        for (std::size_t j = 0; j < dim; ++j)
+            mean[j] += X(i, j) / static_cast<double>(samples);
+
+    DenseMatrix<double> ref(dim, dim);
+    for (std::size_t a = 0; a < dim; ++a)
+        for (std::size_t b = 0; b < dim; ++b)
+        {
+            double s = 0.0;
+            for (std::size_t i = 0; i < samples; ++i)
+                s += (X(i, a) - mean[a]) * (X(i, b) - mean[b]);
+            ref(a, b) = s / static_cast<double>(samples - 1);
+        };
+
+    seoncore::linalg::OnlineCovariance<double> each(dim);
+    seoncore::linalg::OnlineCovariance<double> batch(dim);
+    seoncore::linalg::OnlineCovariance<double> head(dim);
+    seoncore::linalg::OnlineCovariance<double> tail(dim);
+
+    for (std::size_t i = 0; i < samples; ++i)
+    {
+        each.push(X.row(i));
+        (i < 611 ? head : tail).push(X.row(i));
+    };
+    batch.push(X);
+    head.merge(tail);
+
+    for (const auto* acc : { &each, &batch, &head })
+    {
+        SEONCORE_CHECK(acc->count() == samples);
+        SEONCORE_CHECK(max_diff(acc->covariance(), ref) <= 1e-9);
+
+        double mean_err = 0.0;
+        for (std::size_t j = 0; j < dim; ++j)
+            mean_err = std::max(mean_err, std::fabs(acc->mean()[j] - mean[j]));
+        SEONCORE_CHECK(mean_err <= 1e-11);
+    };
+
+    seoncore::linalg::OnlineCovariance<double> one(dim);
+    one.push(X.row(0));
+    SEONCORE_CHECK(max_diff(one.covariance(), DenseMatrix<double>(dim, dim)) == 0.0);
+};
+
+}; // namespace
+
+void linalg_tests()
+{
+    cholesky_round_trip();
+    cholesky_downdate_rejects();
+    covariance_agrees();
+};
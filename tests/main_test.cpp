@@ -1,6 +1,48 @@
+#include "check.hpp"
 
+void thread_pool_tests();
+void sort_tests();
+void linalg_tests();
+void math_tests();
+void eigen_tests();
+void solvers_tests();
+void product_chain_tests();
+void structured_tests();
+void quantized_tests();
+void transposed_tests();
+void shared_tests();
+void small_tests();
+void conv_tests();
+void distance_tests();
+void random_tests();
+void graph_tests();
+void epilogue_tests();
+void gemm_tests();
+void instrument_tests();
+void numa_tests();
 
 int main()
 {
+    thread_pool_tests();
+    sort_tests();
+    linalg_tests();
+    math_tests();
+    eigen_tests();
+    solvers_tests();
+    product_chain_tests();
+    structured_tests();
+    quantized_tests();
+    transposed_tests();
+    shared_tests();
+    small_tests();
+    conv_tests();
+    distance_tests();
+    random_tests();
+    graph_tests();
+    epilogue_tests();
+    gemm_tests();
+    instrument_tests();
+    numa_tests();
 
+    return seoncore::tests::failures() == 0 ? 0 : 1;
 };
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/elementwise.hpp>
+#include <seoncore/ops/math.hpp>
+#include "check.hpp"
+
+using seoncore::matrix::DenseMatrix;
+using seoncore::ops::math::Accuracy;
+using seoncore::ops::math::Fn;
+
+namespace
+{
+
+constexpr std::size_t samples = std::size_t{1} << 16;
+
+// |got - ref| in units of the last place of TN at ref, with the subnormal
+// spacing below the normal range. A reference beyond the range of TN must
+// come out as infinity.
+template <typename TN>
+long double ulp_error(TN got, long double ref)
+{
+    if (std::fabs(ref) > std::numeric_limits<TN>::max())
+        return (std::isinf(got) && std::signbit(got) == std::signbit(ref)) ? 0.0L : std::numeric_limits<long double>::infinity();
+
+    int e = 0;
+    std::frexp(ref, &e);
+    const int digits = std::numeric_limits<TN>::digits;
+    const int low = std::numeric_limits<TN>::min_exponent - digits;
+    const long double ulp = std::ldexp(1.0L, std::max(e - digits, low));
+    return std::fabs(static_cast<long double>(got) - ref) / ulp;
+};
+
+long double reference(Fn f, long double x, long double p)
+{
+    switch (f)
+    {
+        case Fn::Exp:       return std::exp(x);
+        case Fn::Log:       return std::log(x);
+        case Fn::Tanh:      return std::tanh(x);
+        case Fn::Sigmoid:   return 1.0L / (1.0L + std::exp(-x));
+        case Fn::Sqrt:      return std::sqrt(x);
+        case Fn::Pow:       return std::pow(x, p);
+    };
+    return 0.0L;
+};
+
+// x = m * 2^e with m uniform in [1, 2) and e uniform over [lo, hi].
+template <typename TN>
+std::vector<TN> log_uniform(int lo, int hi, std::mt19937& rng)
+{
+    std::uniform_real_distribution<TN> m(TN{1}, TN{2});
+    std::uniform_int_distribution<int> e(lo, hi);
+
+    std::vector<TN> x(samples);
+    for (TN& v : x) v = std::ldexp(m(rng), e(rng));
+    return x;
+};
+
+template <typename TN>
+std::vector<TN> uniform(TN lo, TN hi, std::mt19937& rng)
+{
+    std::uniform_real_distribution<TN> d(lo, hi);
+
+    std::vector<TN> x(samples);
+    for (TN& v : x) v = d(rng);
+    return x;
+};
+
+// Runs x through the matrix op (the vectorized path) at the given accuracy.
+template <Fn F, typename TN>
+DenseMatrix<TN> apply(const std::vector<TN>& x, TN p, Accuracy acc)
+{
+    DenseMatrix<TN> a(x, x.size(), 1);
+    if constexpr (F == Fn::Exp)             return seoncore::ops::exp(a, acc);
+    else if constexpr (F == Fn::Log)        return seoncore::ops::log(a, acc);
+    else if constexpr (F == Fn::Tanh)       return seoncore::ops::tanh(a, acc);
+    else if constexpr (F == Fn::Sigmoid)    return seoncore::ops::sigmoid(a, acc);
+    else if constexpr (F == Fn::Sqrt)       return seoncore::ops::sqrt(a, acc);
+    else                                    return seoncore::ops::pow(a, p, acc);
+};
+
+// Fast stays within `bound` ulp (plus `per_log` ulp per unit of |p ln x|,
+// for double pow) of the long double reference; Strict agrees with the
+// standard library bit for bit.
+template <Fn F, typename TN>
+void check_range(const std::vector<TN>& x, TN p, double bound, double per_log = 0.0)
+{
+    const DenseMatrix<TN> fast = apply<F>(x, p, Accuracy::Fast);
+    const DenseMatrix<TN> strict = apply<F>(x, p, Accuracy::Strict);
+
+    using bits = std::conditional_t<sizeof(TN) == 4, std::uint32_t, std::uint64_t>;
+
+    long double worst = 0.0L;
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        const long double ref = reference(F, x[i], p);
+        const long double slack = per_log * std::fabs(static_cast<long double>(p) * std::log(static_cast<long double>(x[i])));
+        worst = std::max(worst, ulp_error(fast(i, 0), ref) - slack);
+
+        const TN lib = seoncore::ops::math::eval<F, Accuracy::Strict>(x[i], p);
+        if (std::bit_cast<bits>(strict(i, 0)) != std::bit_cast<bits>(lib) && !(std::isnan(lib) && std::isnan(strict(i, 0))))
+            ++mismatches;
+    };
+
+    // 0.01 ulp covers the rounding of the long double reference itself.
+    SEONCORE_CHECK(worst <= bound + 0.01);
+    SEONCORE_CHECK(mismatches == 0);
+};
+
+// The table in ops/math.hpp, over the finite domain of each function.
+template <typename TN>
+void documented_bounds(std::mt19937& rng)
+{
+    constexpr bool dbl = std::same_as<TN, double>;
+    const TN exp_lo = dbl ? TN(-745.0) : TN(-103.9f);
+    const TN exp_hi = dbl ? TN(709.7) : TN(88.7f);
+    const int emin = std::numeric_limits<TN>::min_exponent - std::numeric_limits<TN>::digits;
+    const int emax = std::numeric_limits<TN>::max_exponent - 1;
+
+    const double exp_ulp = dbl ? 1.0 : 1.1;
+    check_range<Fn::Exp>(uniform<TN>(exp_lo, exp_hi, rng), TN{}, exp_ulp);
+    check_range<Fn::Exp>(uniform<TN>(TN(-1), TN(1), rng), TN{}, exp_ulp);
+    check_range<Fn::Exp>(log_uniform<TN>(emin, -1, rng), TN{}, exp_ulp);
+
+    check_range<Fn::Log>(log_uniform<TN>(emin, emax, rng), TN{}, 0.83);
+    check_range<Fn::Log>(uniform<TN>(TN(0.5), TN(2), rng), TN{}, 0.83);
+
+    const double tanh_ulp = dbl ? 2.6 : 2.4;
+    const double sigmoid_ulp = dbl ? 2.4 : 2.5;
+    for (const TN hi : { TN(1), TN(dbl ? 25 : 12) })
+    {
+        check_range<Fn::Tanh>(uniform<TN>(-hi, hi, rng), TN{}, tanh_ulp);
+        check_range<Fn::Sigmoid>(uniform<TN>(-hi, hi, rng), TN{}, sigmoid_ulp);
+    };
+    check_range<Fn::Tanh>(log_uniform<TN>(emin, -1, rng), TN{}, tanh_ulp);
+    check_range<Fn::Sigmoid>(uniform<TN>(exp_lo, TN(40), rng), TN{}, sigmoid_ulp);
+
+    check_range<Fn::Sqrt>(log_uniform<TN>(emin, emax, rng), TN{}, 0.5);
+
+    for (const TN p : { TN(0.5), TN(-1.25), TN(2), TN(3.7), TN(-13.5) })
+    {
+        check_range<Fn::Pow>(log_uniform<TN>(-12, 12, rng), p, dbl ? 1.0 : 0.5, dbl ? 2.0 : 0.0);
+        check_range<Fn::Pow>(uniform<TN>(TN(0.5), TN(2), rng), p, dbl ? 1.0 : 0.5, dbl ? 2.0 : 0.0);
+    };
+};
+
+// Infinities, zeros, NaN, negative bases and overflowing or underflowing
+// arguments come out as in <cmath>: exactly where the result is zero,
+// infinite or NaN, and within a few ulp elsewhere.
+template <typename TN>
+void special_values()
+{
+    constexpr TN inf = std::numeric_limits<TN>::infinity();
+    constexpr TN nan = std::numeric_limits<TN>::quiet_NaN();
+
+    auto same = [](TN a, TN b)
+    {
+        if (std::isnan(b)) return std::isnan(a);
+        if (std::isinf(b) || b == TN{0}) return a == b && std::signbit(a) == std::signbit(b);
+        return ulp_error(a, b) <= 3.0L;
+    };
+
+    const std::vector<TN> x = { TN(0), TN(-0.0), TN(1), TN(-1), TN(-2.5), inf, -inf, nan,
+                                std::numeric_limits<TN>::denorm_min(), std::numeric_limits<TN>::max(),
+                                TN(-1000), TN(1000) };
+
+    // Bases whose powers are exact, so Fast has no rounding to differ in.
+    const std::vector<TN> bases = { TN(0), TN(-0.0), TN(1), TN(-1), inf, -inf, nan };
+
+    auto check_all = [&]<Fn F>(const std::vector<TN>& in, TN p)
+    {
+        const DenseMatrix<TN> fast = apply<F>(in, p, Accuracy::Fast);
+        for (std::size_t i = 0; i < in.size(); ++i)
+            SEONCORE_CHECK(same(fast(i, 0), seoncore::ops::math::eval<F, Accuracy::Strict>(in[i], p)));
+    };
+
+    check_all.template operator()<Fn::Exp>(x, TN{});
+    check_all.template operator()<Fn::Log>(x, TN{});
+    check_all.template operator()<Fn::Tanh>(x, TN{});
+    check_all.template operator()<Fn::Sqrt>(x, TN{});
+    for (const TN p : { TN(0), TN(2), TN(3), TN(-1), TN(0.5), inf, -inf })
+        check_all.template operator()<Fn::Pow>(bases, p);
+};
+
+}; // namespace
+
+void math_tests()
+{
+    std::mt19937 rng(11);
+
+    documented_bounds<float>(rng);
+    documented_bounds<double>(rng);
+    special_values<float>();
+    special_values<double>();
+};
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/numa.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/parallel/numa.hpp>
+#include <seoncore/parallel/thread_pool.hpp>
+#include <seoncore/storage/numa.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Major;
+using seoncore::matrix::DenseMatrix;
+using seoncore::matrix::NumaDenseMatrix;
+using seoncore::parallel::ThreadPool;
+using seoncore::parallel::numa::Topology;
+using seoncore::storage::NumaPlacement;
+using seoncore::storage::NumaStorage;
+
+namespace
+{
+
+// Fake topologies have the requested shape and never ask for placement;
+// specs that do not parse give one ordinary node.
+void fake_topologies()
+{
+    const Topology t = Topology::make_fake(2, 2);
+    SEONCORE_CHECK(t.fake() && !t.placement_enabled() && t.node_count() == 2);
+    SEONCORE_CHECK((t.node(0).cpus == std::vector<unsigned>{ 0, 1 }) && (t.node(1).cpus == std::vector<unsigned>{ 2, 3 }));
+    SEONCORE_CHECK(t.node_of_cpu(3) == 1 && t.node_of_cpu(99) == 0);
+
+    const Topology p = Topology::parse_fake("2x3");
+    SEONCORE_CHECK(p.fake() && p.node_count() == 2 && p.node(1).cpus.size() == 3);
+    SEONCORE_CHECK(Topology::parse_fake("2").node_count() == 2);
+    SEONCORE_CHECK(!Topology::parse_fake("junk").fake() && Topology::parse_fake("junk").node_count() == 1);
+
+    SEONCORE_CHECK((Topology::parse_list("0-3,8,10-11") == std::vector<unsigned>{ 0, 1, 2, 3, 8, 10, 11 }));
+};
+
+// On a fake 2-node topology, with and without workers, every index of
+// [0, n) is visited exactly once, in non-empty in-range chunks, and there
+// is one part per node whenever n allows it.
+void local_partition_covers_once()
+{
+    const std::size_t sizes[] = { 0, 1, 2, 5, 64, 1000, 4099 };
+    const std::size_t grains[] = { 1, 7, 1000 };
+
+    for (const std::size_t workers : { 0, 1, 3 })
+    {
+        ThreadPool pool(workers, Topology::make_fake(2, 2));
+        for (std::size_t t = 0; t < workers; ++t)
+            SEONCORE_CHECK(pool.worker_node(t, workers) < 2);
+
+        for (const std::size_t n : sizes)
+            for (const std::size_t grain : grains)
+            {
+                const auto hits = std::make_unique<std::atomic<int>[]>(n);
+                std::atomic<std::size_t> calls{ 0 };
+                std::atomic<bool> bad_range{ false };
+
+                pool.parallel_for_local(n, grain, [&](std::size_t lo, std::size_t hi)
+                {
+                    if (lo >= hi || hi > n) bad_range = true;
+                    for (std::size_t i = lo; i < hi && i < n; ++i) ++hits[i];
+                    ++calls;
+                });
+
+                std::size_t wrong = 0;
+                for (std::size_t i = 0; i < n; ++i) wrong += hits[i].load() != 1;
+                SEONCORE_CHECK(wrong == 0 && !bad_range);
+                SEONCORE_CHECK(calls >= std::min<std::size_t>(n, 2));
+            };
+    };
+};
+
+template <typename TN, NumaPlacement P>
+void storage_round_trip()
+{
+    // Either side of the 64 KB threshold above which blocks are mapped
+    // rather than taken from the allocator.
+    constexpr std::size_t threshold = std::size_t{1} << 16;
+    const std::size_t sizes[] = { 0, 1, threshold / sizeof(TN) - 1, threshold / sizeof(TN), 3 * threshold / sizeof(TN) + 5 };
+
+    for (const std::size_t n : sizes)
+    {
+        const NumaStorage<TN, P> zero(n);
+        std::size_t nonzero = 0;
+        for (std::size_t i = 0; i < n; ++i) nonzero += zero[i] != TN{0};
+        SEONCORE_CHECK(nonzero == 0);
+
+        std::vector<TN> values(n);
+        for (std::size_t i = 0; i < n; ++i) values[i] = static_cast<TN>(i % 1000) - TN(500);
+
+        const NumaStorage<TN, P> s(values.begin(), values.end());
+        SEONCORE_CHECK(s.size() == n);
+        SEONCORE_CHECK(s.mapped() == (n * sizeof(TN) >= threshold));
+        SEONCORE_CHECK(std::equal(values.begin(), values.end(), s.data()));
+
+        NumaStorage<TN, P> copy(s);
+        SEONCORE_CHECK(copy == s && copy.mapped() == s.mapped());
+        NumaStorage<TN, P> moved(std::move(copy));
+        SEONCORE_CHECK(moved == s && copy.size() == 0 && !copy.mapped());
+        copy = s;
+        SEONCORE_CHECK(copy == s);
+    };
+};
+
+template <NumaPlacement P>
+void matrix_round_trip()
+{
+    // 90 x 90 doubles sit just under 64 KB, 91 x 91 just over.
+    const std::size_t shapes[][2] = { { 3, 5 }, { 90, 90 }, { 91, 91 }, { 300, 257 } };
+
+    for (const auto& shape : shapes)
+    {
+        const std::size_t rows = shape[0], cols = shape[1];
+        for (const Major major : { Major::Row, Major::Column })
+        {
+            std::vector<double> raw(rows * cols);
+            for (std::size_t i = 0; i < raw.size(); ++i) raw[i] = 0.25 * static_cast<double>(i);
+
+            const NumaDenseMatrix<double, P> A(raw, rows, cols, major);
+            const DenseMatrix<double> D(raw, rows, cols, major);
+
+            NumaDenseMatrix<double, P> B(rows, cols, major);
+            for (std::size_t i = 0; i < rows; ++i)
+                for (std::size_t j = 0; j < cols; ++j)
+                    B(i, j) = A(i, j);
+            const NumaDenseMatrix<double, P> C = B;
+
+            std::size_t wrong = 0;
+            for (std::size_t i = 0; i < rows; ++i)
+                for (std::size_t j = 0; j < cols; ++j)
+                    wrong += A(i, j) != D(i, j) || C(i, j) != D(i, j);
+            SEONCORE_CHECK(wrong == 0);
+        };
+    };
+
+    // A product into NUMA storage equals the ordinary one.
+    NumaDenseMatrix<double, P> A(70, 40), B(40, 110);
+    DenseMatrix<double> Ad(70, 40), Bd(40, 110);
+    for (std::size_t i = 0; i < 70 * 40; ++i) A.data()[i] = Ad.data()[i] = static_cast<double>(i % 13) - 6.0;
+    for (std::size_t i = 0; i < 40 * 110; ++i) B.data()[i] = Bd.data()[i] = static_cast<double>(i % 7) - 3.0;
+
+    const NumaDenseMatrix<double, P> C = seoncore::ops::matmul(A, B);
+    const DenseMatrix<double> Cd = seoncore::ops::matmul(Ad, Bd);
+    SEONCORE_CHECK(std::equal(C.data(), C.data() + 70 * 110, Cd.data()));
+};
+
+}; // namespace
+
+// The storage tests run on the shared pool; ctest repeats the suite with
+// SEONCORE_NUMA_FAKE=2 so that pool has a fake 2-node topology.
+void numa_tests()
+{
+    fake_topologies();
+    local_partition_covers_once();
+
+    storage_round_trip<double, NumaPlacement::FirstTouch>();
+    storage_round_trip<float, NumaPlacement::Partitioned>();
+    storage_round_trip<double, NumaPlacement::Interleave>();
+
+    matrix_round_trip<NumaPlacement::FirstTouch>();
+    matrix_round_trip<NumaPlacement::Partitioned>();
+    matrix_round_trip<NumaPlacement::Interleave>();
+};
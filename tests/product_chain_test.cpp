@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/matrix.hpp>
+#include <seoncore/ops/elementwise.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Major;
+using seoncore::matrix::DenseMatrix;
+using seoncore::matrix::ProductChain;
+
+namespace
+{
+
+DenseMatrix<double> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng, Major major = Major::Row)
+{
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+    DenseMatrix<double> A(m, n, major);
+    for (double& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+template <class A, class B>
+DenseMatrix<double> naive(const A& a, const B& b)
+{
+    DenseMatrix<double> c(a.rows(), b.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < b.cols(); ++j)
+        {
+            double s = 0.0;
+            for (std::size_t k = 0; k < a.cols(); ++k) s += a(i, k) * b(k, j);
+            c(i, j) = s;
+        };
+    return c;
+};
+
+template <class A, class B>
+double max_diff(const A& a, const B& b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols()) return INFINITY;
+
+    double m = 0.0;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            m = std::max(m, std::fabs(a(i, j) - b(i, j)));
+    return m;
+};
+
+// operator* on dense operands builds a chain; reading it gives the
+// product, in an order cheaper than left to right when shapes call for it.
+void chain_matches_naive()
+{
+    std::mt19937 rng(41);
+    const DenseMatrix<double> A = random_matrix(60, 45, rng);
+    const DenseMatrix<double> B = random_matrix(45, 50, rng, Major::Column);
+    const DenseMatrix<double> C = random_matrix(50, 35, rng);
+    const DenseMatrix<double> v = random_matrix(35, 1, rng);
+
+    const DenseMatrix<double> ref = naive(naive(naive(A, B), C), v);
+
+    auto P = A * B * C * v;
+    static_assert(std::same_as<decltype(P), ProductChain<double>>);
+    SEONCORE_CHECK(P.length() == 4);
+    SEONCORE_CHECK(P.rows() == 60 && P.cols() == 1);
+    SEONCORE_CHECK(P.cost() < P.left_to_right_cost() / 10.0);
+    SEONCORE_CHECK(max_diff(P, ref) <= 1e-12);
+
+    const DenseMatrix<double> R = A * B * C * v;
+    SEONCORE_CHECK(max_diff(R, ref) <= 1e-12);
+    SEONCORE_CHECK(max_diff(seoncore::ops::multi_dot(A, B, C, v), ref) <= 1e-12);
+
+    // Grouping on the right, and chains of chains, flatten into one.
+    auto Q = (A * B) * (C * v);
+    SEONCORE_CHECK(Q.length() == 4);
+    SEONCORE_CHECK(max_diff(Q, ref) <= 1e-12);
+
+    // Transposed views are factors too, read through their strides.
+    const DenseMatrix<double> At = random_matrix(45, 60, rng, Major::Column);
+    auto T = B.transposed() * At;
+    SEONCORE_CHECK(max_diff(T, naive(B.transposed(), At)) <= 1e-12);
+};
+
+// A chain is MatrixLike: elementwise ops, further products and `auto`
+// work on it, and copies share one evaluation.
+void chain_is_matrix_like()
+{
+    std::mt19937 rng(43);
+    const DenseMatrix<double> A = random_matrix(20, 30, rng);
+    const DenseMatrix<double> B = random_matrix(30, 25, rng);
+    const DenseMatrix<double> X = random_matrix(25, 10, rng);
+    const DenseMatrix<double> AB = naive(A, B);
+
+    const auto abs = seoncore::ops::abs(A * B);
+    double err = 0.0;
+    for (std::size_t i = 0; i < AB.rows(); ++i)
+        for (std::size_t j = 0; j < AB.cols(); ++j)
+            err = std::max(err, std::fabs(abs(i, j) - std::fabs(AB(i, j))));
+    SEONCORE_CHECK(err <= 1e-12);
+
+    SEONCORE_CHECK(max_diff(seoncore::ops::matmul(A * B, X), naive(AB, X)) <= 1e-12);
+
+    const auto P = A * B;
+    const auto copy = P;
+    SEONCORE_CHECK(&P.value() == &copy.value());
+    SEONCORE_CHECK(&P(3, 4) == &P.value()(3, 4));
+
+    // Appending to a copy leaves the original's result alone.
+    auto longer = P;
+    longer.append(X);
+    SEONCORE_CHECK(longer.cols() == X.cols() && P.cols() == B.cols());
+    SEONCORE_CHECK(max_diff(longer, naive(AB, X)) <= 1e-12);
+    SEONCORE_CHECK(max_diff(P, AB) <= 1e-12);
+
+    // Concurrent first reads evaluate once.
+    const auto shared = A * B * X;
+    std::vector<const DenseMatrix<double>*> seen(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < seen.size(); ++t)
+        threads.emplace_back([&, t] { seen[t] = &shared.value(); });
+    for (auto& t : threads) t.join();
+    SEONCORE_CHECK(std::all_of(seen.begin(), seen.end(), [&](auto* p) { return p == seen[0]; }));
+};
+
+// Temporary operands are kept alive by the chain.
+void chain_owns_temporaries()
+{
+    std::mt19937 rng(47);
+    const DenseMatrix<double> A = random_matrix(12, 9, rng);
+    const DenseMatrix<double> B = random_matrix(9, 7, rng);
+
+    const DenseMatrix<double> M = random_matrix(9, 9, rng);
+
+    auto P = A * DenseMatrix<double>(M) * DenseMatrix<double>(B);
+    std::vector<DenseMatrix<double>> churn;
+    for (int i = 0; i < 8; ++i) churn.push_back(random_matrix(9, 9, rng));
+
+    SEONCORE_CHECK(max_diff(P, naive(naive(A, M), B)) <= 1e-12);
+};
+
+}; // namespace
+
+void product_chain_tests()
+{
+    chain_matches_naive();
+    chain_is_matrix_like();
+    chain_owns_temporaries();
+};
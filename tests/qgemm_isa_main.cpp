@@ -0,0 +1,34 @@
+#include "check.hpp"
+
+#if !defined(__AVX2__)
+#error "built for one of the AVX2 kernel paths of ops/qgemm.hpp (see CMakeLists.txt)"
+#endif
+
+void quantized_tests();
+
+namespace
+{
+
+// Whether the host runs the kernel path this executable was compiled for.
+bool host_supports() noexcept
+{
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    return __builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512vl");
+#elif defined(__AVXVNNI__)
+    return __builtin_cpu_supports("avxvnni");
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+};
+
+}; // namespace
+
+// The int8 tests against one kernel path; 77 reports a skip to ctest.
+int main()
+{
+    if (!host_supports()) return 77;
+
+    quantized_tests();
+
+    return seoncore::tests::failures() == 0 ? 0 : 1;
+};
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <seoncore/enums/axis.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/operators.hpp>
+#include <seoncore/matrix/quantized.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/ops/qgemm.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Axis;
+using seoncore::matrix::DenseMatrix;
+using seoncore::matrix::QuantizedMatrix;
+using seoncore::matrix::quantize;
+
+namespace
+{
+
+// Rows and columns of varying range and sign, so scales and zero points
+// differ per slice along either axis.
+DenseMatrix<float> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> ud(-1.0f, 1.0f);
+    DenseMatrix<float> A(m, n);
+    for (std::size_t i = 0; i < m; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            const float scale = (0.25f + static_cast<float>(i % 4)) * (1.0f + static_cast<float>(j % 3));
+            const float shift = (i % 3 == 0 || j % 5 == 0) ? 0.5f : 0.0f;
+            A(i, j) = scale * (ud(rng) + shift);
+        };
+    return A;
+};
+
+// Half a quantization step of slice s: the most a code is off by.
+float half_step(const QuantizedMatrix& q, std::size_t s)
+{
+    return 0.5f * q.scales()[s];
+};
+
+// C = a * b against the product of the dequantized operands, which the
+// integer path computes exactly up to float rounding of the result, and
+// against the float product, within the error the quantization allows:
+//   |ab - a'b'| <= |a| hb + (|b| + hb) ha  per term, with h half a step.
+void check_product(
+        const DenseMatrix<float>& C,
+        const DenseMatrix<float>& a,
+        const DenseMatrix<float>& b,
+        const QuantizedMatrix& qa,
+        const QuantizedMatrix& qb)
+{
+    SEONCORE_CHECK(C.rows() == a.rows() && C.cols() == b.cols());
+    if (C.rows() != a.rows() || C.cols() != b.cols()) return;
+
+    const DenseMatrix<float> da = qa.dequantize();
+    const DenseMatrix<float> db = qb.dequantize();
+    const bool a_rows = qa.axis() == Axis::Row;
+    const bool b_rows = qb.axis() == Axis::Row;
+
+    double worst_exact = 0.0;
+    double worst_bound = 0.0;
+    for (std::size_t i = 0; i < C.rows(); ++i)
+        for (std::size_t j = 0; j < C.cols(); ++j)
+        {
+            double exact = 0.0, mag = 0.0, ref = 0.0, bound = 0.0;
+            for (std::size_t p = 0; p < a.cols(); ++p)
+            {
+                const double x = da(i, p);
+                const double y = db(p, j);
+                exact += x * y;
+                mag += std::fabs(x * y);
+
+                const double ha = half_step(qa, a_rows ? i : p);
+                const double hb = half_step(qb, b_rows ? p : j);
+                ref += static_cast<double>(a(i, p)) * b(p, j);
+                bound += std::fabs(a(i, p)) * hb + (std::fabs(b(p, j)) + hb) * ha;
+            };
+
+            worst_exact = std::max(worst_exact, std::fabs(C(i, j) - exact) / (mag + 1e-30));
+            worst_bound = std::max(worst_bound, std::fabs(C(i, j) - ref) / (1.001 * bound + 1e-6 * mag + 1e-30));
+        };
+
+    SEONCORE_CHECK(worst_exact <= 1e-6);
+    SEONCORE_CHECK(worst_bound <= 1.0);
+};
+
+// quantize(A) * quantize(B) through the int8 kernel (row-quantized A,
+// column-quantized B) and through the float fallback (any other axes), and
+// the mixed overloads that quantize the float side on the fly. k covers the
+// vector tail, one full 2^16 block and more than one.
+void products_within_bound()
+{
+    std::mt19937 rng(59);
+
+    for (const std::size_t k : { 1, 7, 32, 33, 100, 1000, 65536, 70001 })
+    {
+        const std::size_t m = 3;
+        const std::size_t n = 9;
+        const DenseMatrix<float> A = random_matrix(m, k, rng);
+        const DenseMatrix<float> B = random_matrix(k, n, rng);
+
+        const QuantizedMatrix qa = quantize(A);
+        const QuantizedMatrix qb = quantize(B, Axis::Column);
+        check_product(qa * qb, A, B, qa, qb);
+
+        const QuantizedMatrix qa_col = quantize(A, Axis::Column);
+        const QuantizedMatrix qb_row = quantize(B, Axis::Row);
+        check_product(qa_col * qb_row, A, B, qa_col, qb_row);
+
+        check_product(qa * B, A, B, qa, qb);
+        check_product(A * qb, A, B, qa, qb);
+    };
+};
+
+// Full-scale codes of one sign: k * 127^2 overflows int32 from k ~ 133k,
+// which is what the int64 partials are for.
+void long_k_does_not_overflow()
+{
+    const std::size_t k = 300007;
+
+    const DenseMatrix<float> ones(std::vector<float>(2 * k, 1.0f), 2, k);
+    const DenseMatrix<float> signs(std::vector<float>(k * 5, -1.0f), k, 5);
+
+    const DenseMatrix<float> C = quantize(ones) * quantize(signs, Axis::Column);
+    for (std::size_t i = 0; i < C.rows(); ++i)
+        for (std::size_t j = 0; j < C.cols(); ++j)
+            SEONCORE_CHECK(std::fabs(C(i, j) + static_cast<float>(k)) <= 1e-5f * static_cast<float>(k));
+
+    std::mt19937 rng(61);
+    std::uniform_int_distribution<int> code(QuantizedMatrix::qmin, QuantizedMatrix::qmax);
+    std::vector<std::int8_t> a(k), b(4 * k);
+    for (std::size_t p = 0; p < k; ++p)
+        a[p] = (p % 5 == 0) ? static_cast<std::int8_t>(code(rng)) : std::int8_t{127};
+    for (std::size_t p = 0; p < 4 * k; ++p)
+        b[p] = (p % 7 == 0) ? static_cast<std::int8_t>(code(rng)) : static_cast<std::int8_t>((p / k) % 2 ? -127 : 127);
+
+    for (const std::size_t len : { std::size_t{31}, std::size_t{65536}, std::size_t{65567}, k })
+    {
+        std::int64_t want[4] = {};
+        for (std::size_t t = 0; t < 4; ++t)
+            for (std::size_t p = 0; p < len; ++p)
+                want[t] += static_cast<std::int64_t>(a[p]) * b[t * k + p];
+
+        std::int64_t got[4];
+        seoncore::ops::kernels::dot_i8x4(a.data(), b.data(), b.data() + k, b.data() + 2 * k, b.data() + 3 * k, len, got);
+        for (std::size_t t = 0; t < 4; ++t)
+        {
+            SEONCORE_CHECK(got[t] == want[t]);
+            SEONCORE_CHECK(seoncore::ops::kernels::dot_i8(a.data(), b.data() + t * k, len) == want[t]);
+        };
+    };
+};
+
+}; // namespace
+
+void quantized_tests()
+{
+    products_within_bound();
+    long_k_does_not_overflow();
+};
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/random/philox.hpp>
+#include <seoncore/random/random.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Major;
+using seoncore::matrix::DenseMatrix;
+using seoncore::random::Philox4x32;
+
+namespace
+{
+
+// Known-answer vectors of the Random123 reference implementation
+// (kat_vectors, philox4x32 with 10 rounds).
+void philox_known_answers()
+{
+    using block = Philox4x32::block_type;
+
+    SEONCORE_CHECK(Philox4x32(0)(block{ 0, 0, 0, 0 }) == (block{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 }));
+    SEONCORE_CHECK(Philox4x32(0xffffffffffffffffull)(block{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff })
+                   == (block{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd }));
+    SEONCORE_CHECK(Philox4x32(0x299f31d0a4093822ull)(block{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 })
+                   == (block{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }));
+
+    // block() and the lane-major batch are the same bijection on the
+    // (index, stream) counter.
+    const Philox4x32 rng(0x0123456789abcdefull, 0x5eedull << 32 | 7);
+    std::array<std::array<std::uint32_t, 8>, 4> lanes;
+    const std::uint64_t first = 0xfffffffcull;
+    rng.blocks<8>(first, lanes);
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        const std::uint64_t index = first + i;
+        const block want = rng({ static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32), 7, 0x5eed });
+        SEONCORE_CHECK(rng.block(index) == want);
+        SEONCORE_CHECK((block{ lanes[0][i], lanes[1][i], lanes[2][i], lanes[3][i] }) == want);
+    };
+};
+
+template <typename TN>
+bool equal(const DenseMatrix<TN>& a, const DenseMatrix<TN>& b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols()) return false;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            if (a(i, j) != b(i, j)) return false;
+    return true;
+};
+
+// Element (i, j) depends only on (seed, stream, i * cols + j): both storage
+// orders agree, at sizes off the per-block count and past one work grain.
+template <typename TN>
+void storage_order_agrees()
+{
+    using namespace seoncore::random;
+
+    const std::size_t shapes[][2] = { { 1, 1 }, { 37, 23 }, { 130, 131 } };
+    for (const auto& [rows, cols] : shapes)
+    {
+        SEONCORE_CHECK(equal(random_uniform<TN>(rows, cols, 42, TN(-1), TN(1), Major::Row),
+                             random_uniform<TN>(rows, cols, 42, TN(-1), TN(1), Major::Column)));
+        SEONCORE_CHECK(equal(random_normal<TN>(rows, cols, 42, TN(0), TN(2), Major::Row),
+                             random_normal<TN>(rows, cols, 42, TN(0), TN(2), Major::Column)));
+
+        DenseMatrix<TN> a(rows, cols, Major::Row);
+        DenseMatrix<TN> b(rows, cols, Major::Column);
+        fill_uniform(a, 7, TN(0), TN(1), 3);
+        fill_uniform(b, 7, TN(0), TN(1), 3);
+        SEONCORE_CHECK(equal(a, b));
+
+        fill_uniform(b, 7, TN(0), TN(1), 4);
+        SEONCORE_CHECK(rows * cols == 1 || !equal(a, b));
+    };
+};
+
+// [lo, hi) holds even where lo + (hi - lo) * u rounds up to hi: next to
+// 2^20 (float) or 2^50 (double) the spacing is 1/8 or 1/4, so most draws in
+// the top of the unit interval would otherwise land on hi.
+template <typename TN>
+void uniform_excludes_hi()
+{
+    const TN lo = std::ldexp(TN(1), sizeof(TN) == 4 ? 20 : 50);
+    const TN hi = lo + TN(1);
+
+    const DenseMatrix<TN> M = seoncore::random::random_uniform<TN>(200, 500, 11, lo, hi);
+    const auto flat = M.flatten();
+    const auto [mn, mx] = std::minmax_element(flat.begin(), flat.end());
+    SEONCORE_CHECK(*mn == lo);
+    SEONCORE_CHECK(*mx < hi && *mx == std::nextafter(hi, lo));
+
+    const DenseMatrix<TN> U = seoncore::random::random_uniform<TN>(200, 500, 13, TN(-3), TN(5));
+    const auto uf = U.flatten();
+    SEONCORE_CHECK(std::all_of(uf.begin(), uf.end(), [](TN v) { return v >= TN(-3) && v < TN(5); }));
+};
+
+}; // namespace
+
+void random_tests()
+{
+    philox_known_answers();
+    storage_order_agrees<float>();
+    storage_order_agrees<double>();
+    uniform_excludes_hi<float>();
+    uniform_excludes_hi<double>();
+};
@@ -0,0 +1,131 @@
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <seoncore/matrix/diagonal.hpp>
+#include <seoncore/matrix/matrix.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/storage/shared.hpp>
+#include "check.hpp"
+
+using seoncore::matrix::DenseMatrix;
+using seoncore::matrix::DiagonalMatrix;
+using seoncore::matrix::SharedDenseMatrix;
+using seoncore::storage::SharedStorage;
+
+namespace
+{
+
+SharedDenseMatrix<double> counting(std::size_t m, std::size_t n)
+{
+    SharedDenseMatrix<double> A(m, n);
+    auto flat = A.flatten();
+    for (std::size_t i = 0; i < flat.size(); ++i) flat[i] = static_cast<double>(i);
+    return A;
+};
+
+bool is_counting(const SharedDenseMatrix<double>& A)
+{
+    const auto flat = A.flatten();
+    for (std::size_t i = 0; i < flat.size(); ++i)
+        if (flat[i] != static_cast<double>(i)) return false;
+    return true;
+};
+
+const double* buffer(const SharedDenseMatrix<double>& A) { return A.data(); };
+
+// Copies share the buffer until one of them is written; the write, through
+// any non-const access, goes to a private buffer and leaves the other
+// copies as they were.
+void copy_then_write()
+{
+    const SharedDenseMatrix<double> A = counting(4, 5);
+
+    SharedDenseMatrix<double> B = A;
+    SEONCORE_CHECK(buffer(B) == buffer(A));
+    SEONCORE_CHECK(B(1, 2) == A(1, 2));
+
+    B(1, 2) = -1.0;
+    SEONCORE_CHECK(buffer(B) != buffer(A));
+    SEONCORE_CHECK(is_counting(A));
+    SEONCORE_CHECK(B(1, 2) == -1.0 && B(3, 4) == A(3, 4));
+
+    // Once detached, further writes stay in B's own buffer.
+    const double* own = buffer(B);
+    B(0, 0) = -2.0;
+    B.row(3)[1] = -3.0;
+    SEONCORE_CHECK(buffer(B) == own);
+    SEONCORE_CHECK(is_counting(A));
+
+    SharedDenseMatrix<double> C(1, 1);
+    C = A;
+    SEONCORE_CHECK(buffer(C) == buffer(A));
+    C.flatten()[7] = 0.5;
+    SEONCORE_CHECK(buffer(C) != buffer(A) && C(1, 2) == 0.5 && is_counting(A));
+
+    SharedDenseMatrix<double> D = A;
+    D.col(2)[0] = 9.0;
+    SEONCORE_CHECK(D(0, 2) == 9.0 && is_counting(A));
+};
+
+// Writing through the original detaches it instead, leaving the copy with
+// the old contents.
+void write_through_original()
+{
+    SharedDenseMatrix<double> A = counting(3, 3);
+    const SharedDenseMatrix<double> B = A;
+
+    A.data()[4] = 100.0;
+    SEONCORE_CHECK(A(1, 1) == 100.0);
+    SEONCORE_CHECK(is_counting(B));
+    SEONCORE_CHECK(buffer(A) != buffer(B));
+};
+
+// Reference counts follow copies, moves and destruction; const access never
+// detaches.
+void storage_counts()
+{
+    SharedStorage<int> s(8);
+    SEONCORE_CHECK(s.use_count() == 1 && s.unique());
+
+    {
+        const SharedStorage<int> t = s;
+        SEONCORE_CHECK(s.use_count() == 2 && t.use_count() == 2);
+        SEONCORE_CHECK(t.data() == std::as_const(s).data());
+        SEONCORE_CHECK(t[3] == 0 && s.use_count() == 2);
+
+        SharedStorage<int> u = t;
+        SharedStorage<int> v = std::move(u);
+        SEONCORE_CHECK(u.use_count() == 0 && v.use_count() == 3);
+
+        v[0] = 1;
+        SEONCORE_CHECK(v.unique() && s.use_count() == 2 && t[0] == 0);
+    };
+    SEONCORE_CHECK(s.unique());
+
+    SEONCORE_CHECK(SharedStorage<int>().use_count() == 0);
+};
+
+// Kernels that fill a shared-storage result through data() see a fresh,
+// unshared buffer.
+void kernel_results()
+{
+    const SharedDenseMatrix<double> B = counting(4, 3);
+    DiagonalMatrix<double> D(4);
+    for (std::size_t i = 0; i < 4; ++i) D(i, i) = 2.0;
+
+    const SharedDenseMatrix<double> C = seoncore::ops::matmul(D, B);
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 3; ++j)
+            SEONCORE_CHECK(C(i, j) == 2.0 * B(i, j));
+    SEONCORE_CHECK(is_counting(B));
+};
+
+}; // namespace
+
+void shared_tests()
+{
+    copy_then_write();
+    write_through_original();
+    storage_counts();
+    kernel_results();
+};
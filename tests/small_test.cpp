@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <seoncore/matrix/matrix.hpp>
+#include <seoncore/matrix/small.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include <seoncore/storage/small.hpp>
+#include "check.hpp"
+
+using seoncore::matrix::SmallDenseMatrix;
+using seoncore::storage::SmallStorage;
+
+namespace
+{
+
+// Counts live instances, so leaks and double destruction across the
+// inline/heap boundary show up as a nonzero balance.
+struct Tracked
+{
+    static inline int live = 0;
+
+    int v = 0;
+
+    Tracked() noexcept { ++live; };
+    Tracked(int x) noexcept : v(x) { ++live; };
+    Tracked(const Tracked& o) noexcept : v(o.v) { ++live; };
+    Tracked(Tracked&& o) noexcept : v(o.v) { o.v = -1; ++live; };
+    Tracked& operator=(const Tracked&) noexcept = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() noexcept { --live; };
+
+    bool operator==(const Tracked& o) const noexcept { return v == o.v; };
+};
+
+using Store = SmallStorage<Tracked, 4>;
+
+Store iota(std::size_t n)
+{
+    Store s(n);
+    for (std::size_t i = 0; i < n; ++i) s[i].v = static_cast<int>(i) + 1;
+    return s;
+};
+
+bool holds_iota(const Store& s, std::size_t n)
+{
+    if (s.size() != n) return false;
+    for (std::size_t i = 0; i < n; ++i)
+        if (s[i].v != static_cast<int>(i) + 1) return false;
+    return true;
+};
+
+// Up to N elements stay inline; one more spills to the heap.
+void inline_up_to_capacity()
+{
+    for (std::size_t n = 0; n <= Store::inline_capacity + 2; ++n)
+    {
+        const Store s = iota(n);
+        SEONCORE_CHECK(s.is_inline() == (n <= Store::inline_capacity));
+        SEONCORE_CHECK(holds_iota(s, n));
+        SEONCORE_CHECK(Tracked::live == static_cast<int>(n));
+    };
+    SEONCORE_CHECK(Tracked::live == 0);
+
+    const int raw[] = { 1, 2, 3, 4, 5 };
+    SEONCORE_CHECK(Store(raw, raw + 4).is_inline());
+    SEONCORE_CHECK(!Store(raw, raw + 5).is_inline());
+};
+
+// Copy and move construction and assignment between every pairing of
+// inline and heap storage. A moved-from buffer is empty and inline.
+void copy_move_across_boundary()
+{
+    const std::size_t sizes[] = { 0, 3, 4, 5, 9 };
+
+    for (const std::size_t from : sizes)
+    {
+        const Store src = iota(from);
+
+        Store copy(src);
+        SEONCORE_CHECK(holds_iota(copy, from) && holds_iota(src, from));
+        SEONCORE_CHECK(copy.is_inline() == src.is_inline());
+        SEONCORE_CHECK(from == 0 || copy.data() != src.data());
+
+        Store moved(std::move(copy));
+        SEONCORE_CHECK(holds_iota(moved, from));
+        SEONCORE_CHECK(copy.size() == 0 && copy.is_inline());
+
+        for (const std::size_t to : sizes)
+        {
+            Store a = iota(to);
+            a = src;
+            SEONCORE_CHECK(holds_iota(a, from) && a.is_inline() == (from <= Store::inline_capacity));
+
+            Store b = iota(to);
+            Store c = iota(from);
+            b = std::move(c);
+            SEONCORE_CHECK(holds_iota(b, from) && b.is_inline() == (from <= Store::inline_capacity));
+            SEONCORE_CHECK(c.size() == 0 && c.is_inline());
+        };
+
+        Store self = iota(from);
+        self = std::as_const(self);
+        SEONCORE_CHECK(holds_iota(self, from));
+    };
+    SEONCORE_CHECK(Tracked::live == 0);
+};
+
+// Whether the matrix elements live inside the object itself.
+template <class M>
+bool stored_inline(const M& m)
+{
+    const auto* p = reinterpret_cast<const unsigned char*>(m.data());
+    const auto* o = reinterpret_cast<const unsigned char*>(&m);
+    return p >= o && p < o + sizeof(M);
+};
+
+template <class M>
+M random_small(std::size_t rows, std::size_t cols, std::mt19937& rng)
+{
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+    M A(rows, cols);
+    for (double& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+template <class A, class B>
+double max_diff_naive(const A& c, const B& a, const B& b)
+{
+    double m = 0.0;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < b.cols(); ++j)
+        {
+            double s = 0.0;
+            for (std::size_t k = 0; k < a.cols(); ++k) s += a(i, k) * b(k, j);
+            m = std::max(m, std::fabs(c(i, j) - s));
+        };
+    return m;
+};
+
+// SmallDenseMatrix keeps a 4x4 inline and spills a 5x5, survives copies
+// and moves either way, and multiplies through the dense kernel and
+// operator* into another SmallDenseMatrix.
+void small_matrices()
+{
+    using M = SmallDenseMatrix<double, 16>;
+    std::mt19937 rng(71);
+
+    const M A = random_small<M>(4, 4, rng);
+    const M H = random_small<M>(5, 5, rng);
+    SEONCORE_CHECK(stored_inline(A) && !stored_inline(H));
+
+    M a = A;
+    M h = H;
+    SEONCORE_CHECK(stored_inline(a) && !stored_inline(h) && a(3, 3) == A(3, 3) && h(4, 4) == H(4, 4));
+
+    a = std::move(h);
+    SEONCORE_CHECK(!stored_inline(a) && a.rows() == 5 && a(4, 4) == H(4, 4));
+    h = A;
+    SEONCORE_CHECK(stored_inline(h) && h.rows() == 4 && h(3, 3) == A(3, 3));
+
+    const M moved(std::move(h));
+    SEONCORE_CHECK(stored_inline(moved) && moved(3, 3) == A(3, 3));
+
+    const M B = random_small<M>(4, 4, rng);
+    const M C = seoncore::ops::matmul(A, B);
+    SEONCORE_CHECK(stored_inline(C) && max_diff_naive(C, A, B) <= 1e-14);
+
+    const M D = A * B;
+    SEONCORE_CHECK(stored_inline(D) && max_diff_naive(D, A, B) <= 1e-14);
+
+    const M G = random_small<M>(5, 5, rng);
+    const M E = H * G;
+    SEONCORE_CHECK(!stored_inline(E) && max_diff_naive(E, H, G) <= 1e-14);
+};
+
+}; // namespace
+
+void small_tests()
+{
+    inline_up_to_capacity();
+    copy_move_across_boundary();
+    small_matrices();
+};
@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/solvers/solvers.hpp>
+#include <seoncore/views/vec.hpp>
+#include "check.hpp"
+
+using seoncore::matrix::DenseMatrix;
+using seoncore::solvers::SolverOptions;
+using seoncore::solvers::SolverStats;
+using seoncore::views::MutableVectorView;
+using seoncore::views::VectorView;
+
+namespace
+{
+
+constexpr std::size_t grid = 16;
+constexpr std::size_t n = grid * grid;
+
+// Five-point Laplacian on a grid x grid mesh with Dirichlet boundaries,
+// plus a first-order upwind convection term of strength `wind` along both
+// axes (nonsymmetric when wind != 0).
+DenseMatrix<double> convection_diffusion(double wind)
+{
+    DenseMatrix<double> A(n, n);
+    for (std::size_t i = 0; i < grid; ++i)
+        for (std::size_t j = 0; j < grid; ++j)
+        {
+            const std::size_t k = i * grid + j;
+            A(k, k) = 4.0 + 2.0 * wind;
+            if (i > 0)          A(k, k - grid) = -1.0 - wind;
+            if (i + 1 < grid)   A(k, k + grid) = -1.0;
+            if (j > 0)          A(k, k - 1) = -1.0 - wind;
+            if (j + 1 < grid)   A(k, k + 1) = -1.0;
+        };
+    return A;
+};
+
+std::vector<double> random_vector(std::mt19937& rng)
+{
+    std::normal_distribution<double> nd;
+    std::vector<double> v(n);
+    for (double& e : v) e = nd(rng);
+    return v;
+};
+
+// ||b - A x|| / ||b|| recomputed from scratch, not the solver's recurrence.
+double true_residual(const DenseMatrix<double>& A, const std::vector<double>& b, const std::vector<double>& x)
+{
+    double rr = 0.0;
+    double bb = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double r = b[i];
+        for (std::size_t j = 0; j < n; ++j) r -= A(i, j) * x[j];
+        rr += r * r;
+        bb += b[i] * b[i];
+    };
+    return std::sqrt(rr / bb);
+};
+
+// Solves A x = b from x = 0 with `solve(b, x)` and checks the reported and
+// the actual residual against rtol. Returns the iteration count.
+template <class Solve>
+std::size_t check_converges(const DenseMatrix<double>& A, const std::vector<double>& b, double rtol, Solve&& solve)
+{
+    std::vector<double> x(n, 0.0);
+    const SolverStats stats = solve(VectorView<double>(b.data(), n, 1), MutableVectorView<double>(x.data(), n, 1));
+
+    SEONCORE_CHECK(stats.converged);
+    SEONCORE_CHECK(stats.iterations > 0);
+    SEONCORE_CHECK(stats.relative_residual <= rtol);
+    SEONCORE_CHECK(true_residual(A, b, x) <= 10.0 * rtol);
+    return stats.iterations;
+};
+
+// CG on the SPD Laplacian, given as a matrix and as a callable operator,
+// unpreconditioned and with Jacobi and ILU(0). ILU(0) must cut the
+// iteration count.
+void cg_converges()
+{
+    using namespace seoncore::solvers;
+
+    std::mt19937 rng(17);
+    const DenseMatrix<double> A = convection_diffusion(0.0);
+    const std::vector<double> b = random_vector(rng);
+
+    SolverOptions opts;
+    opts.rtol = 1e-10;
+
+    const std::size_t plain = check_converges(A, b, opts.rtol, [&](auto bv, auto xv)
+    {
+        return cg(A, bv, xv, IdentityPreconditioner<double>{}, opts);
+    });
+
+    auto op = [&A](VectorView<double> x, MutableVectorView<double> y)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double s = 0.0;
+            for (std::size_t j = 0; j < n; ++j) s += A(i, j) * x[j];
+            y[i] = s;
+        };
+    };
+    const std::size_t matrix_free = check_converges(A, b, opts.rtol, [&](auto bv, auto xv)
+    {
+        return cg(op, bv, xv, IdentityPreconditioner<double>{}, opts);
+    });
+    SEONCORE_CHECK(matrix_free == plain);
+
+    const JacobiPreconditioner<double> jacobi(A);
+    check_converges(A, b, opts.rtol, [&](auto bv, auto xv) { return cg(A, bv, xv, jacobi, opts); });
+
+    const ILU0Preconditioner<double> ilu(A);
+    const std::size_t pre = check_converges(A, b, opts.rtol, [&](auto bv, auto xv) { return cg(A, bv, xv, ilu, opts); });
+    SEONCORE_CHECK(pre < plain);
+
+    // One solver instance serves several right-hand sides.
+    ConjugateGradient<double> solver(n, opts);
+    for (int rhs = 0; rhs < 3; ++rhs)
+    {
+        const std::vector<double> c = random_vector(rng);
+        check_converges(A, c, opts.rtol, [&](auto bv, auto xv) { return solver.solve(A, bv, xv, jacobi); });
+    };
+};
+
+// BiCGSTAB and GMRES on the nonsymmetric convection-diffusion operator,
+// with each preconditioner; GMRES also with a short restart.
+void nonsymmetric_converge()
+{
+    using namespace seoncore::solvers;
+
+    std::mt19937 rng(23);
+    const DenseMatrix<double> A = convection_diffusion(1.5);
+    const std::vector<double> b = random_vector(rng);
+
+    SolverOptions opts;
+    opts.rtol = 1e-10;
+
+    const JacobiPreconditioner<double> jacobi(A);
+    const ILU0Preconditioner<double> ilu(A);
+
+    const std::size_t bicg_plain = check_converges(A, b, opts.rtol, [&](auto bv, auto xv)
+    {
+        return bicgstab(A, bv, xv, IdentityPreconditioner<double>{}, opts);
+    });
+    check_converges(A, b, opts.rtol, [&](auto bv, auto xv) { return bicgstab(A, bv, xv, jacobi, opts); });
+    const std::size_t bicg_ilu = check_converges(A, b, opts.rtol, [&](auto bv, auto xv) { return bicgstab(A, bv, xv, ilu, opts); });
+    SEONCORE_CHECK(bicg_ilu < bicg_plain);
+
+    const std::size_t gmres_plain = check_converges(A, b, opts.rtol, [&](auto bv, auto xv)
+    {
+        return gmres(A, bv, xv, IdentityPreconditioner<double>{}, opts);
+    });
+    check_converges(A, b, opts.rtol, [&](auto bv, auto xv) { return gmres(A, bv, xv, jacobi, opts); });
+    const std::size_t gmres_ilu = check_converges(A, b, opts.rtol, [&](auto bv, auto xv) { return gmres(A, bv, xv, ilu, opts); });
+    SEONCORE_CHECK(gmres_ilu < gmres_plain);
+
+    SolverOptions short_restart = opts;
+    short_restart.restart = 5;
+    check_converges(A, b, opts.rtol, [&](auto bv, auto xv) { return gmres(A, bv, xv, ilu, short_restart); });
+};
+
+// A zero right-hand side is solved before any iteration, and running out
+// of iterations is reported as not converged rather than passed off.
+void reports_status()
+{
+    using namespace seoncore::solvers;
+
+    std::mt19937 rng(29);
+    const DenseMatrix<double> A = convection_diffusion(0.0);
+    const std::vector<double> zero(n, 0.0);
+    const std::vector<double> b = random_vector(rng);
+
+    SolverOptions capped;
+    capped.max_iterations = 3;
+    capped.rtol = 1e-12;
+
+    auto run = [&](const std::vector<double>& rhs, auto&& solve)
+    {
+        std::vector<double> x(n, 0.0);
+        return solve(VectorView<double>(rhs.data(), n, 1), MutableVectorView<double>(x.data(), n, 1));
+    };
+
+    const auto cg_solve = [&](auto bv, auto xv) { return cg(A, bv, xv, IdentityPreconditioner<double>{}, capped); };
+    const auto bicg_solve = [&](auto bv, auto xv) { return bicgstab(A, bv, xv, IdentityPreconditioner<double>{}, capped); };
+    const auto gmres_solve = [&](auto bv, auto xv) { return gmres(A, bv, xv, IdentityPreconditioner<double>{}, capped); };
+
+    for (const SolverStats s : { run(zero, cg_solve), run(zero, bicg_solve), run(zero, gmres_solve) })
+        SEONCORE_CHECK(s.converged && s.iterations == 0 && s.residual_norm == 0.0);
+
+    for (const SolverStats s : { run(b, cg_solve), run(b, bicg_solve), run(b, gmres_solve) })
+        SEONCORE_CHECK(!s.converged && s.iterations <= capped.max_iterations && s.relative_residual > capped.rtol);
+};
+
+}; // namespace
+
+void solvers_tests()
+{
+    cg_converges();
+    nonsymmetric_converge();
+    reports_status();
+};
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/ops/sort.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Axis;
+using seoncore::matrix::DenseMatrix;
+using seoncore::ops::SortOrder;
+
+namespace
+{
+
+// The documented order: NaNs last in both directions, -0.0 before +0.0
+// (after it when descending), ties by index.
+template <typename TN>
+bool before(TN x, TN y, bool desc)
+{
+    if constexpr (std::is_floating_point_v<TN>)
+    {
+        if (std::isnan(x) || std::isnan(y)) return !std::isnan(x) && std::isnan(y);
+        if (x == y) return desc ? (!std::signbit(x) && std::signbit(y)) : (std::signbit(x) && !std::signbit(y));
+    };
+    return desc ? y < x : x < y;
+};
+
+template <typename TN>
+std::vector<std::size_t> reference_order(const std::vector<TN>& v, bool desc)
+{
+    std::vector<std::size_t> idx(v.size());
+    for (std::size_t i = 0; i < idx.size(); ++i) idx[i] = i;
+    std::stable_sort(idx.begin(), idx.end(), [&](std::size_t a, std::size_t b) { return before(v[a], v[b], desc); });
+    return idx;
+};
+
+template <typename TN>
+bool same_value(TN x, TN y)
+{
+    if constexpr (std::is_floating_point_v<TN>)
+        if (std::isnan(x) || std::isnan(y)) return std::isnan(x) && std::isnan(y);
+    return x == y && std::signbit(static_cast<double>(x)) == std::signbit(static_cast<double>(y));
+};
+
+// Few distinct values so that ties are common, plus signed zeros and NaNs.
+template <typename TN>
+std::vector<TN> sample(std::size_t n, std::mt19937& rng)
+{
+    std::vector<TN> v(n);
+    for (TN& x : v)
+    {
+        const unsigned r = rng() % 16;
+        x = static_cast<TN>(static_cast<int>(r % 7) - 3);
+        if constexpr (std::is_floating_point_v<TN>)
+        {
+            if (r == 13) x = TN{-0.0};
+            if (r == 14) x = std::numeric_limits<TN>::quiet_NaN();
+            if (r == 15) x = -std::numeric_limits<TN>::quiet_NaN();
+        };
+    };
+    return v;
+};
+
+template <typename TN>
+void check_lines(std::size_t rows, std::size_t cols, Axis axis, SortOrder order, std::mt19937& rng)
+{
+    const bool desc = (order == SortOrder::Descending);
+    const bool by_row = (axis == Axis::Row);
+    const std::size_t lines = by_row ? rows : cols;
+    const std::size_t len = by_row ? cols : rows;
+
+    DenseMatrix<TN> M(sample<TN>(rows * cols, rng), rows, cols);
+    auto at = [&](const auto& X, std::size_t line, std::size_t p) { return by_row ? X(line, p) : X(p, line); };
+
+    const DenseMatrix<std::size_t> idx = seoncore::ops::argsort(M, axis, order);
+    const std::size_t k = len / 3 + 1;
+    const auto top = seoncore::ops::topk(M, k, axis, order);
+
+    DenseMatrix<TN> S = M;
+    seoncore::ops::sort(S, axis, order);
+
+    for (std::size_t line = 0; line < lines; ++line)
+    {
+        std::vector<TN> v(len);
+        for (std::size_t p = 0; p < len; ++p) v[p] = at(M, line, p);
+        const std::vector<std::size_t> ref = reference_order(v, desc);
+
+        bool argsort_ok = true;
+        bool sort_ok = true;
+        bool topk_ok = true;
+        for (std::size_t p = 0; p < len; ++p)
+        {
+            argsort_ok = argsort_ok && at(idx, line, p) == ref[p];
+            sort_ok = sort_ok && same_value(at(S, line, p), v[ref[p]]);
+        };
+        for (std::size_t p = 0; p < std::min(k, len); ++p)
+            topk_ok = topk_ok && at(top.indices, line, p) == ref[p] && same_value(at(top.values, line, p), v[ref[p]]);
+
+        SEONCORE_CHECK(argsort_ok);
+        SEONCORE_CHECK(sort_ok);
+        SEONCORE_CHECK(topk_ok);
+    };
+};
+
+// Lengths on both sides of the sorting-network, std::sort and radix paths.
+template <typename TN>
+void sort_matches_reference()
+{
+    std::mt19937 rng(7);
+    for (std::size_t len : { 1, 2, 5, 16, 31, 32, 33, 63, 64, 200, 1500 })
+        for (Axis axis : { Axis::Row, Axis::Column })
+            for (SortOrder order : { SortOrder::Ascending, SortOrder::Descending })
+            {
+                const std::size_t lines = 19;
+                if (axis == Axis::Row) check_lines<TN>(lines, len, axis, order, rng);
+                else                   check_lines<TN>(len, lines, axis, order, rng);
+            };
+};
+
+void vector_views()
+{
+    std::mt19937 rng(11);
+    const std::vector<double> v = sample<double>(300, rng);
+    DenseMatrix<double> M(v, 1, v.size());
+
+    const std::vector<std::size_t> ref = reference_order(v, false);
+    SEONCORE_CHECK(seoncore::ops::argsort(M.row(0)) == ref);
+
+    const std::vector<std::size_t> top = seoncore::ops::topk(M.row(0), 10, SortOrder::Ascending);
+    SEONCORE_CHECK(std::equal(top.begin(), top.end(), ref.begin()));
+
+    seoncore::ops::sort(M.row(0));
+    bool nan_last = true;
+    for (std::size_t p = 0; p < v.size(); ++p)
+        nan_last = nan_last && same_value(M(0, p), v[ref[p]]);
+    SEONCORE_CHECK(nan_last);
+};
+
+void partition_splits_at_k()
+{
+    std::mt19937 rng(5);
+    for (std::size_t k : { 0, 1, 50, 99 })
+    {
+        std::vector<double> v = sample<double>(100, rng);
+        DenseMatrix<double> M(v, 1, v.size());
+        seoncore::ops::partition(M.row(0), k);
+
+        const std::vector<std::size_t> ref = reference_order(v, false);
+        bool ok = same_value(M(0, k), v[ref[k]]);
+        for (std::size_t p = 0; p < v.size(); ++p)
+        {
+            if (p < k) ok = ok && !before(M(0, k), M(0, p), false);
+            if (p > k) ok = ok && !before(M(0, p), M(0, k), false);
+        };
+        SEONCORE_CHECK(ok);
+    };
+};
+
+}; // namespace
+
+void sort_tests()
+{
+    sort_matches_reference<double>();
+    sort_matches_reference<float>();
+    sort_matches_reference<int>();
+    vector_views();
+    partition_splits_at_k();
+};
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/enums/triangle.hpp>
+#include <seoncore/matrix/banded.hpp>
+#include <seoncore/matrix/dense.hpp>
+#include <seoncore/matrix/diagonal.hpp>
+#include <seoncore/matrix/symmetric.hpp>
+#include <seoncore/matrix/triangular.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include "check.hpp"
+
+#if !defined(NDEBUG) && defined(__unix__)
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using seoncore::enums::Major;
+using seoncore::enums::Triangle;
+using seoncore::matrix::BandedMatrix;
+using seoncore::matrix::DenseMatrix;
+using seoncore::matrix::DiagonalMatrix;
+using seoncore::matrix::SymmetricMatrix;
+using seoncore::matrix::TriangularMatrix;
+
+namespace
+{
+
+DenseMatrix<double> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng, Major major = Major::Row)
+{
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+    DenseMatrix<double> A(m, n, major);
+    for (double& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+// Fills the stored entries of a structured matrix through its writable
+// element access.
+template <class M>
+void fill_stored(M& m, std::mt19937& rng)
+{
+    std::uniform_real_distribution<double> ud(-1.0, 1.0);
+    for (std::size_t i = 0; i < m.rows(); ++i)
+        for (std::size_t j = 0; j < m.cols(); ++j)
+            if (m(i, j).stored()) m(i, j) = ud(rng);
+};
+
+template <class A, class B>
+double max_diff(const A& a, const B& b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols()) return INFINITY;
+
+    double m = 0.0;
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < a.cols(); ++j)
+            m = std::max(m, std::fabs(a(i, j) - b(i, j)));
+    return m;
+};
+
+// The structured overload against the generic loop over operator().
+template <class A, class B>
+void check_product(const A& a, const B& b)
+{
+    const auto fast = seoncore::ops::matmul(a, b);
+    const auto slow = seoncore::ops::matmul_fallback(a, b);
+    SEONCORE_CHECK(max_diff(fast, slow) <= 1e-13);
+};
+
+// D * M, M * D, band x dense, TRMM and SYMM on both sides, with operands
+// in both storage orders.
+void products_match_fallback()
+{
+    std::mt19937 rng(53);
+    const std::size_t n = 23;
+
+    for (const Major major : { Major::Row, Major::Column })
+    {
+        const DenseMatrix<double> B = random_matrix(n, 17, rng, major);
+        const DenseMatrix<double> A = random_matrix(19, n, rng, major);
+
+        DiagonalMatrix<double> D(n);
+        fill_stored(D, rng);
+        check_product(D, B);
+        check_product(A, D);
+
+        const std::pair<std::size_t, std::size_t> bands[] = { { 0, 0 }, { 2, 1 }, { 0, 4 }, { 5, 0 }, { 30, 30 } };
+        for (const auto& [kl, ku] : bands)
+        {
+            BandedMatrix<double> K(n, n, kl, ku);
+            fill_stored(K, rng);
+            check_product(K, B);
+            check_product(A, K);
+        };
+
+        for (const Triangle uplo : { Triangle::Lower, Triangle::Upper })
+        {
+            TriangularMatrix<double> T(n, uplo);
+            fill_stored(T, rng);
+            check_product(T, B);
+            check_product(A, T);
+        };
+
+        SymmetricMatrix<double> S(n);
+        std::uniform_real_distribution<double> ud(-1.0, 1.0);
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j <= i; ++j)
+                S(i, j) = ud(rng);
+        check_product(S, B);
+        check_product(A, S);
+    };
+};
+
+// Entries outside the structure read as zero through both accessors, hand
+// out no shared slot, and accept zero; stored entries behave as TN&.
+void off_structure_access()
+{
+    DiagonalMatrix<double> D(4);
+    D(2, 2) = 3.0;
+    D(1, 1) += 2.0;
+    D(0, 3) = 0.0;
+
+    SEONCORE_CHECK(D(2, 2) == 3.0 && D(1, 1) == 2.0);
+    SEONCORE_CHECK(!D(0, 3).stored() && D(0, 3) == 0.0);
+    SEONCORE_CHECK(std::as_const(D)(3, 0) == 0.0);
+
+    TriangularMatrix<double> L(5, Triangle::Lower);
+    L(4, 1) = 7.0;
+    L(3, 3) = L(4, 1);
+    SEONCORE_CHECK(L(3, 3) == 7.0 && !L(1, 4).stored() && L(1, 4) == 0.0);
+
+    BandedMatrix<double> K(6, 6, 1, 1);
+    K(2, 3) = -1.0;
+    K(3, 2) *= 4.0;
+    SEONCORE_CHECK(K(2, 3) == -1.0 && K(3, 2) == 0.0 && !K(0, 5).stored());
+    SEONCORE_CHECK(K.transposed()(3, 2) == -1.0);
+};
+
+#if !defined(NDEBUG) && defined(__unix__)
+// True if fn() aborts, run in a child process with stderr silenced.
+template <class F>
+bool aborts(F&& fn)
+{
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        const int null = open("/dev/null", O_WRONLY);
+        if (null >= 0) dup2(null, 2);
+        fn();
+        _exit(0);
+    };
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFSIGNALED(status);
+};
+
+void off_structure_writes_rejected()
+{
+    SEONCORE_CHECK(aborts([] { DiagonalMatrix<double> D(3); D(0, 1) = 1.0; }));
+    SEONCORE_CHECK(aborts([] { TriangularMatrix<double> U(3, Triangle::Upper); U(2, 0) = 1.0; }));
+    SEONCORE_CHECK(aborts([] { BandedMatrix<double> K(5, 5, 1, 0); K(0, 3) += 1.0; }));
+    SEONCORE_CHECK(!aborts([] { DiagonalMatrix<double> D(3); D(0, 1) = 0.0; D(1, 1) = 1.0; }));
+};
+#else
+void off_structure_writes_rejected() {};
+#endif
+
+}; // namespace
+
+void structured_tests()
+{
+    products_match_fallback();
+    off_structure_access();
+    off_structure_writes_rejected();
+};
@@ -0,0 +1,63 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <seoncore/parallel/thread_pool.hpp>
+#include "check.hpp"
+
+using seoncore::parallel::ThreadPool;
+
+namespace
+{
+
+// An exception from any chunk, on the caller or on a worker, reaches the
+// caller once every helper has left the job, and the pool stays usable.
+void exception_propagates()
+{
+    ThreadPool pool(3);
+    const std::size_t chunks = pool.chunk_count(1000, 1);
+
+    for (std::size_t bad = 0; bad < chunks; ++bad)
+    {
+        std::atomic<std::size_t> done{0};
+        bool caught = false;
+        try
+        {
+            pool.parallel_for(1000, 1, [&](std::size_t lo, std::size_t hi)
+            {
+                if (lo == ThreadPool::chunk_range(1000, chunks, bad).first)
+                    throw std::runtime_error("chunk");
+                done += hi - lo;
+            });
+        }
+        catch (const std::runtime_error&)
+        {
+            caught = true;
+        };
+        SEONCORE_CHECK(caught);
+        SEONCORE_CHECK(done < 1000);
+    };
+
+    const int sum = pool.parallel_reduce(1000, 1, 0,
+        [](std::size_t lo, std::size_t hi) { return static_cast<int>(hi - lo); },
+        [](int a, int b) { return a + b; });
+    SEONCORE_CHECK(sum == 1000);
+};
+
+void partition_is_complete()
+{
+    ThreadPool pool(3);
+    for (std::size_t n : { 0, 1, 7, 100, 4097 })
+    {
+        std::atomic<std::size_t> covered{0};
+        pool.parallel_for(n, 3, [&](std::size_t lo, std::size_t hi) { covered += hi - lo; });
+        SEONCORE_CHECK(covered == n);
+    };
+};
+
+}; // namespace
+
+void thread_pool_tests()
+{
+    exception_propagates();
+    partition_is_complete();
+};
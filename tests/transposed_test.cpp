@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <seoncore/enums/major.hpp>
+#include <seoncore/matrix/matrix.hpp>
+#include <seoncore/ops/matmul.hpp>
+#include "check.hpp"
+
+using seoncore::enums::Major;
+using seoncore::matrix::DenseMatrix;
+
+namespace
+{
+
+template <typename TN>
+DenseMatrix<TN> random_matrix(std::size_t m, std::size_t n, std::mt19937& rng, Major major)
+{
+    std::uniform_real_distribution<TN> ud(TN(-1), TN(1));
+    DenseMatrix<TN> A(m, n, major);
+    for (TN& v : A.flatten()) v = ud(rng);
+    return A;
+};
+
+// The triple loop in double, read through operator() of whatever a and b are.
+template <class A, class B>
+DenseMatrix<double> naive(const A& a, const B& b)
+{
+    DenseMatrix<double> c(a.rows(), b.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i)
+        for (std::size_t j = 0; j < b.cols(); ++j)
+        {
+            double s = 0.0;
+            for (std::size_t k = 0; k < a.cols(); ++k)
+                s += static_cast<double>(a(i, k)) * static_cast<double>(b(k, j));
+            c(i, j) = s;
+        };
+    return c;
+};
+
+template <class C>
+double max_diff(const C& c, const DenseMatrix<double>& ref)
+{
+    if (c.rows() != ref.rows() || c.cols() != ref.cols()) return INFINITY;
+
+    double m = 0.0;
+    for (std::size_t i = 0; i < c.rows(); ++i)
+        for (std::size_t j = 0; j < c.cols(); ++j)
+            m = std::max(m, std::fabs(static_cast<double>(c(i, j)) - ref(i, j)));
+    return m;
+};
+
+// Transposed views on either side or both, const and mutable, nested, with
+// each operand's storage in either order, against the triple loop. The
+// shapes are off the kernel's tile multiples.
+template <typename TN>
+void check_shapes(double tol)
+{
+    using seoncore::ops::matmul;
+
+    std::mt19937 rng(67);
+    const std::size_t shapes[][3] = { { 1, 1, 1 }, { 1, 9, 4 }, { 7, 13, 5 }, { 67, 45, 130 }, { 97, 130, 66 } };
+
+    for (const auto& [m, n, k] : shapes)
+        for (const Major ma : { Major::Row, Major::Column })
+            for (const Major mb : { Major::Row, Major::Column })
+            {
+                const DenseMatrix<TN> A = random_matrix<TN>(m, k, rng, ma);
+                const DenseMatrix<TN> B = random_matrix<TN>(k, n, rng, mb);
+                DenseMatrix<TN> At = random_matrix<TN>(k, m, rng, ma);
+                DenseMatrix<TN> Bt = random_matrix<TN>(n, k, rng, mb);
+
+                SEONCORE_CHECK(max_diff(matmul(A, B), naive(A, B)) <= tol);
+                SEONCORE_CHECK(max_diff(matmul(std::as_const(At).transposed(), B), naive(At.transposed(), B)) <= tol);
+                SEONCORE_CHECK(max_diff(matmul(A, std::as_const(Bt).transposed()), naive(A, Bt.transposed())) <= tol);
+                SEONCORE_CHECK(max_diff(matmul(At.transposed(), Bt.transposed()), naive(At.transposed(), Bt.transposed())) <= tol);
+                SEONCORE_CHECK(max_diff(matmul(A.transposed().transposed(), Bt.transposed()), naive(A, Bt.transposed())) <= tol);
+
+                SEONCORE_CHECK(max_diff(A * Bt.transposed(), naive(A, Bt.transposed())) <= tol);
+                SEONCORE_CHECK(max_diff(At.transposed() * Bt.transposed(), naive(At.transposed(), Bt.transposed())) <= tol);
+            };
+};
+
+// Views of dense storage take the tagged (kernel) path, not the fallback.
+template <typename TN>
+void views_take_kernel()
+{
+    using Dense = DenseMatrix<TN>;
+    using View = decltype(std::declval<const Dense&>().transposed());
+    using MutView = decltype(std::declval<Dense&>().transposed());
+    using Nested = decltype(std::declval<const View&>().transposed());
+
+    static_assert(seoncore::ops::has_tagged_matmul<const View&, const Dense&>);
+    static_assert(seoncore::ops::has_tagged_matmul<const Dense&, const View&>);
+    static_assert(seoncore::ops::has_tagged_matmul<const View&, const MutView&>);
+    static_assert(seoncore::ops::has_tagged_matmul<const Nested&, const View&>);
+};
+
+}; // namespace
+
+void transposed_tests()
+{
+    views_take_kernel<float>();
+    views_take_kernel<double>();
+    check_shapes<float>(1e-4);
+    check_shapes<double>(1e-12);
+};